@@ -115,6 +115,16 @@ bool Light::enableCrc32()
 #endif
 }
 
+bool Light::enableCrc32c()
+{
+#if defined(CONFIG_ENABLE_CRC32C)
+    m_crc = HDLC_CRC_32C;
+    return true;
+#else
+    return false;
+#endif
+}
+
 #ifdef ARDUINO
 
 static int writeToSerial(void *p, const void *b, int s)
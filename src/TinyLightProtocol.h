@@ -215,6 +215,16 @@ public:
      */
     bool enableCrc32();
 
+    /**
+     * Enables CRC-32C (Castagnoli) 32-bit field in the protocol.
+     * On x86-64 and AArch64 hosts it is calculated with cpu crc instructions.
+     * 32-bit field is not supported by Nano version of
+     * Tiny library.
+     * @return true if successful
+     *         false in case of error.
+     */
+    bool enableCrc32c();
+
 private:
     STinyLightData m_data{};
 
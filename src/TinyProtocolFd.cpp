@@ -51,6 +51,11 @@ void IFd::onSendInternal(void *handle, uint8_t addr, const uint8_t *pdata, int s
     (reinterpret_cast<IFd *>(handle))->onSend(addr, pdata, size);
 }
 
+void IFd::onMessageInternal(void *handle, uint8_t addr, uint8_t *pdata, int size)
+{
+    (reinterpret_cast<IFd *>(handle))->onMessage(addr, pdata, size);
+}
+
 void IFd::onConnectEventInternal(void *handle, uint8_t addr, bool connected)
 {
     (reinterpret_cast<IFd *>(handle))->onConnectEvent(addr, connected);
@@ -66,8 +71,22 @@ void IFd::begin()
     init.buffer = m_buffer;
     init.buffer_size = m_bufferSize;
     init.window_frames = m_window;
+    init.extended_mode = m_extendedMode;
+    init.selective_repeat = m_selectiveRepeat;
+    init.small_frames = m_smallFrames;
+    init.small_mtu = m_smallMtu;
+    init.ack_frames = m_ackFrames;
+    init.ack_delay = m_ackDelay;
+    init.checkpointing = m_checkpointing;
+    if ( m_onMessage )
+    {
+        init.on_message_cb = onMessageInternal;
+        init.message_size = m_messageSize;
+    }
     init.send_timeout = m_sendTimeout;
     init.retry_timeout = 200;
+    init.rto_min = m_rtoMin;
+    init.rto_max = m_rtoMax;
     init.retries = 2;
     init.crc_type = m_crc;
     init.mode = TINY_FD_MODE_ABM;
@@ -92,6 +111,44 @@ int IFd::write(const IPacket &pkt)
     return tiny_fd_send_packet(m_handle, pkt.m_buf, pkt.m_len, m_sendTimeout);
 }
 
+int IFd::writeMessage(const char *buf, int size)
+{
+    return tiny_fd_send_message(m_handle, buf, size, m_sendTimeout);
+}
+
+int IFd::reserve(IPacket &pkt, int size)
+{
+    uint8_t *buf = tiny_fd_tx_reserve(m_handle, TINY_FD_PRIMARY_ADDR, size, m_sendTimeout);
+    if ( buf == nullptr )
+    {
+        return TINY_ERR_FAILED;
+    }
+    pkt.m_buf = buf;
+    pkt.m_size = size;
+    pkt.clear();
+    return TINY_SUCCESS;
+}
+
+int IFd::commit(IPacket &pkt)
+{
+    int result = tiny_fd_tx_commit(m_handle, pkt.m_buf, pkt.m_len);
+    if ( result != TINY_ERR_DATA_TOO_LARGE )
+    {
+        pkt.m_buf = nullptr;
+        pkt.m_size = 0;
+    }
+    return result;
+}
+
+int IFd::abort(IPacket &pkt)
+{
+    int result = tiny_fd_tx_abort(m_handle, pkt.m_buf);
+    pkt.m_buf = nullptr;
+    pkt.m_size = 0;
+    pkt.clear();
+    return result;
+}
+
 int IFd::run_rx(const void *data, int len)
 {
     return tiny_fd_on_rx_data(m_handle, data, len);
@@ -163,6 +220,12 @@ bool IFd::enableCrc32()
     return true;
 }
 
+bool IFd::enableCrc32c()
+{
+    m_crc = HDLC_CRC_32C;
+    return true;
+}
+
 ///////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////
 
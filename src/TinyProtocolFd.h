@@ -115,6 +115,39 @@ public:
      */
     int write(const IPacket &pkt);
 
+    /**
+     * Reserves room in outgoing queue, and attaches the packet to it. The application
+     * can fill the packet using put() methods without copying data once again, and then must
+     * call commit() or abort().
+     * @param pkt - Packet to attach to the reserved room. Packet buffer is replaced.
+     * @param size - maximum size of the packet data
+     * @return TINY_SUCCESS or TINY_ERR_FAILED if there is no room in outgoing queue
+     */
+    int reserve(IPacket &pkt, int size);
+
+    /**
+     * Sends packet, attached to outgoing queue by reserve() method.
+     * @param pkt - Packet to send
+     * @return TINY_SUCCESS or error code
+     */
+    int commit(IPacket &pkt);
+
+    /**
+     * Releases room, reserved by reserve() method, without sending the packet.
+     * @param pkt - reserved Packet
+     * @return TINY_SUCCESS or error code
+     */
+    int abort(IPacket &pkt);
+
+    /**
+     * Sends message of any length, split to several frames. The remote side must use
+     * setMessageCallback() to receive messages.
+     * @param buf - message to send
+     * @param size - length of the message in bytes
+     * @return TINY_SUCCESS or error code
+     */
+    int writeMessage(const char *buf, int size);
+
     /**
      * Processes incoming rx data, specified by a user.
      * @param data pointer to the buffer with incoming data
@@ -191,6 +224,16 @@ public:
      */
     bool enableCrc32();
 
+    /**
+     * Enables CRC-32C (Castagnoli) 32-bit field in the protocol.
+     * On x86-64 and AArch64 hosts it is calculated with cpu crc instructions.
+     * 32-bit field is not supported by Nano version of
+     * Tiny library.
+     * @return true if successful
+     *         false in case of error.
+     */
+    bool enableCrc32c();
+
     /**
      * Sets receive callback for incoming messages
      * @param on_receive user callback to process incoming messages. The processing must be non-blocking
@@ -218,10 +261,23 @@ public:
         m_onConnectEvent = on_connect;
     }
 
+    /**
+     * Sets callback for messages, sent by writeMessage(). If the callback is set, all incoming frames
+     * are treated as message fragments, and receive callback is not called.
+     * Reassembly buffer is allocated from the protocol buffer. Use this function only before begin() call.
+     * @param on_message user callback to process incoming messages. The processing must be non-blocking
+     * @param maxSize maximum size of incoming message in bytes
+     */
+    void setMessageCallback(void (*on_message)(void *userData, uint8_t addr, IPacket &pkt), int maxSize)
+    {
+        m_onMessage = on_message;
+        m_messageSize = maxSize;
+    }
+
     /**
      * Sets desired window size. Use this function only before begin() call.
      * window size is number of frames, which confirmation may be deferred for.
-     * @param window window size, valid between 1 - 7 inclusively
+     * @param window window size, valid between 1 - 7 inclusively, or up to 127 in extended mode
      * @warning if you use smallest window size, this can reduce throughput of the channel.
      */
     void setWindowSize(uint8_t window)
@@ -229,6 +285,74 @@ public:
         m_window = window;
     }
 
+    /**
+     * Enables extended (modulo 128) sequence numbers, which allow window size up to 127.
+     * Use this function only before begin() call. Both endpoints must use the same mode.
+     * @param enabled true to use SABME handshake and 2-byte control field
+     */
+    void setExtendedMode(bool enabled)
+    {
+        m_extendedMode = enabled;
+    }
+
+    /**
+     * Enables selective repeat: out of order frames are buffered, and only missing frames are requested
+     * by SREJ. Window size must not exceed 4 (or 64 in extended mode) on both endpoints.
+     * Use this function only before begin() call.
+     * @param enabled true to buffer out of order frames instead of go-back-N retransmission
+     */
+    void setSelectiveRepeat(bool enabled)
+    {
+        m_selectiveRepeat = enabled;
+    }
+
+    /**
+     * Makes some of tx window slots small to save RAM. Use this function only before begin() call.
+     * Frames up to mtu bytes use small slots, longer frames use remaining full-size slots.
+     * @param frames number of small slots, must be less than window size. 0 disables small slots.
+     * @param mtu maximum payload size of small slots in bytes
+     */
+    void setSmallFrames(uint8_t frames, int mtu)
+    {
+        m_smallFrames = frames;
+        m_smallMtu = mtu;
+    }
+
+    /**
+     * Enables adaptive retransmission timeout, calculated from measured round trip time.
+     * Use this function only before begin() call.
+     * @param minTimeout lower bound of retransmission timeout in milliseconds
+     * @param maxTimeout upper bound of retransmission timeout in milliseconds, 0 to use fixed timeout
+     */
+    void setAdaptiveTimeout(uint16_t minTimeout, uint16_t maxTimeout)
+    {
+        m_rtoMin = minTimeout;
+        m_rtoMax = maxTimeout;
+    }
+
+    /**
+     * Enables delayed acknowledgements: single RR frame confirms several received frames.
+     * Use this function only before begin() call.
+     * @param frames number of frames to confirm by single RR, 0 to confirm half of window
+     * @param delay maximum time in milliseconds to delay RR, 0 disables delayed acknowledgements
+     */
+    void setAckDelay(uint8_t frames, uint16_t delay)
+    {
+        m_ackFrames = frames;
+        m_ackDelay = delay;
+    }
+
+    /**
+     * Enables P/F checkpointing in ABM mode: lost frames at the end of burst are retransmitted
+     * as soon as the peer answers the checkpoint, without waiting for retransmission timeout.
+     * Use this function only before begin() call.
+     * @param enable true to enable checkpointing
+     */
+    void setCheckpointing(bool enable)
+    {
+        m_checkpointing = enable;
+    }
+
     /**
      * Sets send timeout in milliseconds.
      * @param timeout timeout in milliseconds,
@@ -279,6 +403,21 @@ protected:
             m_onReceive(m_userData, addr, pkt);
     }
 
+    /**
+     * Method called by fd protocol upon receiving complete message.
+     * Can be redefined in derived classes.
+     * @param addr address of peer station
+     * @param pdata pointer to received message
+     * @param size size of received message in bytes
+     */
+    virtual void onMessage(uint8_t addr, uint8_t *pdata, int size)
+    {
+        IPacket pkt((char *)pdata, size);
+        pkt.m_len = size;
+        if ( m_onMessage )
+            m_onMessage(m_userData, addr, pkt);
+    }
+
     /**
      * Method called by hdlc protocol upon sending next frame.
      * Can be redefined in derived classes.
@@ -324,6 +463,33 @@ private:
     /** Limit window to only 3 frames for small controllers by default */
     uint8_t m_window = 3;
 
+    /** Extended (modulo 128) sequence numbers are off by default */
+    bool m_extendedMode = false;
+
+    /** Go-back-N retransmission is used by default */
+    bool m_selectiveRepeat = false;
+
+    /** Number of small tx slots, no small slots by default */
+    uint8_t m_smallFrames = 0;
+
+    /** Payload size of small tx slots */
+    int m_smallMtu = 0;
+
+    /** Number of frames, confirmed by single RR frame */
+    uint8_t m_ackFrames = 0;
+
+    /** Each frame is confirmed immediately by default */
+    uint16_t m_ackDelay = 0;
+
+    /** Lower bound of adaptive retransmission timeout */
+    uint16_t m_rtoMin = 0;
+
+    /** Fixed retransmission timeout is used by default */
+    uint16_t m_rtoMax = 0;
+
+    /** Lost frames are recovered on timeout by default */
+    bool m_checkpointing = false;
+
     /** Callback, when new frame is received */
     void (*m_onReceive)(void *userData, uint8_t addr, IPacket &pkt) = nullptr;
 
@@ -333,6 +499,12 @@ private:
     /** Callback, when connect/disconnect event takes place */
     void (*m_onConnectEvent)(void *userData, uint8_t addr, bool connected) = nullptr;
 
+    /** Callback, when complete message is received */
+    void (*m_onMessage)(void *userData, uint8_t addr, IPacket &pkt) = nullptr;
+
+    /** Maximum size of incoming message */
+    int m_messageSize = 0;
+
     /** user data to pass to the callbacks */
     void *m_userData = nullptr;
 
@@ -342,6 +514,9 @@ private:
     /** Internal function */
     static void onSendInternal(void *handle, uint8_t addr, const uint8_t *pdata, int size);
 
+    /** Internal function */
+    static void onMessageInternal(void *handle, uint8_t addr, uint8_t *pdata, int size);
+
     /** Internal function */
     static void onConnectEventInternal(void *handle, uint8_t addr, bool connected);
 };
@@ -127,6 +127,12 @@ bool Hdlc::enableCrc32()
     return true;
 }
 
+bool Hdlc::enableCrc32c()
+{
+    m_crc = HDLC_CRC_32C;
+    return true;
+}
+
 ///////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////
 
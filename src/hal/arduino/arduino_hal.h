@@ -47,6 +47,10 @@
 //#   define CONFIG_ENABLE_FCS32
 //#endif
 
+//#ifndef CONFIG_ENABLE_CRC32C
+//#   define CONFIG_ENABLE_CRC32C
+//#endif
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 
 /**
@@ -45,6 +45,10 @@
 #define CONFIG_ENABLE_FCS32
 #endif
 
+#ifndef CONFIG_ENABLE_CRC32C
+#define CONFIG_ENABLE_CRC32C
+#endif
+
 #define CONFIG_TINYHAL_THREAD_SUPPORT 1
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
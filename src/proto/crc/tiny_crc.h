@@ -36,10 +36,26 @@ extern "C"
 {
 #endif
 
+/**
+ * Number of bytes processed per step by tiny_crc16_update() and tiny_crc32_update().
+ * 1 uses only the classic 256-entry tables (default, suitable for small targets).
+ * 8 and 16 enable slice-by-N kernels, which need N - 1 extra precomputed constant tables:
+ * 3.5/7 KiB (crc16/crc32) for 8 slices and 7.5/15 KiB for 16 slices.
+ */
+#ifndef CONFIG_TINY_CRC_SLICES
+#define CONFIG_TINY_CRC_SLICES 1
+#endif
+
+#if CONFIG_TINY_CRC_SLICES != 1 && CONFIG_TINY_CRC_SLICES != 8 && CONFIG_TINY_CRC_SLICES != 16
+#error "CONFIG_TINY_CRC_SLICES must be 1, 8 or 16"
+#endif
+
 #ifdef CONFIG_ENABLE_CHECKSUM
 #define INITCHECKSUM 0x0000
 #define GOODCHECKSUM 0x0000
     uint16_t chksum_byte(uint16_t sum, uint8_t data);
+    /** Adds data to running sum without finalization: tiny_chksum() == 0xFFFF - tiny_chksum_update() */
+    uint16_t tiny_chksum_update(uint16_t sum, const uint8_t* data, int data_length);
     uint16_t tiny_chksum(uint16_t sum, const uint8_t* data, int data_length);
 #endif
 
@@ -47,6 +63,8 @@ extern "C"
 #define PPPINITFCS16 0xffff /* Initial FCS value */
 #define PPPGOODFCS16 0xf0b8 /* Good final FCS value */
     uint16_t crc16_byte(uint16_t crc, uint8_t data);
+    /** Updates running crc without final xor: tiny_crc16() == tiny_crc16_update() ^ 0xFFFF */
+    uint16_t tiny_crc16_update(uint16_t crc, const uint8_t* data, int data_length);
     uint16_t tiny_crc16(uint16_t crc, const uint8_t* data, int data_length);
 #endif
 
@@ -54,11 +72,22 @@ extern "C"
 #define PPPINITFCS32 0xffffffff /* Initial FCS value */
 #define PPPGOODFCS32 0xdebb20e3 /* Good final FCS value */
     uint32_t crc32_byte(uint32_t crc, uint8_t data);
+    /** Updates running crc without final xor: tiny_crc32() == tiny_crc32_update() ^ 0xFFFFFFFF */
+    uint32_t tiny_crc32_update(uint32_t crc, const uint8_t *buf, int size);
     uint32_t tiny_crc32(uint32_t crc, const uint8_t *buf, int size);
 #endif
 
+#ifdef CONFIG_ENABLE_CRC32C
+#define INITCRC32C 0xffffffff /* Initial CRC-32C value */
+#define GOODCRC32C 0xb798b438 /* Good final CRC-32C value */
+    uint32_t crc32c_byte(uint32_t crc, uint8_t data);
+    /** Updates running crc without final xor: tiny_crc32c() == tiny_crc32c_update() ^ 0xFFFFFFFF */
+    uint32_t tiny_crc32c_update(uint32_t crc, const uint8_t *buf, int size);
+    uint32_t tiny_crc32c(uint32_t crc, const uint8_t *buf, int size);
+#endif
+
 /// \cond
-#ifdef CONFIG_ENABLE_FCS32
+#if defined(CONFIG_ENABLE_FCS32) || defined(CONFIG_ENABLE_CRC32C)
     typedef uint32_t crc_t;
 #else
 typedef uint16_t crc_t;
@@ -74,6 +103,7 @@ typedef uint16_t crc_t;
         HDLC_CRC_8 = 8,       ///< Simple sum of all bytes in user payload
         HDLC_CRC_16 = 16,     ///< CCITT-16
         HDLC_CRC_32 = 32,     ///< CCITT-32
+        HDLC_CRC_32C = 33,    ///< CRC-32C (Castagnoli), 4-byte field (value / 8)
         HDLC_CRC_OFF = 0xFF,  ///< Disable CRC field
     } hdlc_crc_t;
 
@@ -0,0 +1,259 @@
+/*
+    Copyright 2025 (C) Alexey Dynda
+
+    This file is part of Tiny Protocol Library.
+
+    GNU General Public License Usage
+
+    Protocol Library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Protocol Library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with Protocol Library.  If not, see <http://www.gnu.org/licenses/>.
+
+    Commercial License Usage
+
+    Licensees holding valid commercial Tiny Protocol licenses may use this file in
+    accordance with the commercial license agreement provided in accordance with
+    the terms contained in a written agreement between you and Alexey Dynda.
+    For further information contact via email on github account.
+*/
+
+#include "tiny_crc_int.h"
+
+#include <string.h>
+
+#if defined(TINY_CRC32_HW_SUPPORTED) && defined(__x86_64__)
+
+#include <immintrin.h>
+
+#ifdef CONFIG_ENABLE_FCS32
+
+/*
+ * Folding constants for bit-reflected CRC-32 (0x04C11DB7) from Intel's
+ * "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction".
+ * k1 = x^(4*128+32) mod P, k2 = x^(4*128-32) mod P, k3 = x^(128+32) mod P,
+ * k4 = x^(128-32) mod P, k5 = x^64 mod P, mu = x^64 / P, all bit-reflected.
+ */
+static const uint64_t k1k2[2] __attribute__((aligned(16))) = {0x0154442bd4ULL, 0x01c6e41596ULL};
+static const uint64_t k3k4[2] __attribute__((aligned(16))) = {0x01751997d0ULL, 0x00ccaa009eULL};
+static const uint64_t k5k0[2] __attribute__((aligned(16))) = {0x0163cd6124ULL, 0x0000000000ULL};
+static const uint64_t poly[2] __attribute__((aligned(16))) = {0x01db710641ULL, 0x01f7011641ULL};
+
+__attribute__((target("pclmul,sse2"))) static uint32_t crc32_pclmul_update(uint32_t crc, const uint8_t *buf, int size)
+{
+    if ( size < 64 )
+    {
+        return tiny_crc32_sw_update(crc, buf, size);
+    }
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+    x1 = _mm_loadu_si128((const __m128i *)(buf + 0x00));
+    x2 = _mm_loadu_si128((const __m128i *)(buf + 0x10));
+    x3 = _mm_loadu_si128((const __m128i *)(buf + 0x20));
+    x4 = _mm_loadu_si128((const __m128i *)(buf + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+    x0 = _mm_load_si128((const __m128i *)k1k2);
+    buf += 64;
+    size -= 64;
+
+    // Fold 4 x 128 bits in parallel
+    while ( size >= 64 )
+    {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i *)(buf + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i *)(buf + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i *)(buf + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i *)(buf + 0x30)));
+        buf += 64;
+        size -= 64;
+    }
+
+    // Fold 4 x 128 bits into single 128 bits value
+    x0 = _mm_load_si128((const __m128i *)k3k4);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // Fold remaining 16-byte blocks
+    while ( size >= 16 )
+    {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128((const __m128i *)buf)), x5);
+        buf += 16;
+        size -= 16;
+    }
+
+    // Reduce 128 bits to 64 bits
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    x0 = _mm_loadl_epi64((const __m128i *)k5k0);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits
+    x0 = _mm_load_si128((const __m128i *)poly);
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    crc = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(x1, 4));
+
+    return tiny_crc32_sw_update(crc, buf, size);
+}
+
+tiny_crc32_update_fn tiny_crc32_hw_detect(void)
+{
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse2") )
+    {
+        return crc32_pclmul_update;
+    }
+    return NULL;
+}
+#endif
+
+#ifdef CONFIG_ENABLE_CRC32C
+__attribute__((target("sse4.2"))) static uint32_t crc32c_sse42_update(uint32_t crc, const uint8_t *buf, int size)
+{
+    uint64_t crc64 = crc;
+    while ( size >= 8 )
+    {
+        uint64_t v;
+        memcpy(&v, buf, sizeof(v));
+        crc64 = _mm_crc32_u64(crc64, v);
+        buf += 8;
+        size -= 8;
+    }
+    crc = (uint32_t)crc64;
+    while ( size-- )
+    {
+        crc = _mm_crc32_u8(crc, *buf++);
+    }
+    return crc;
+}
+
+tiny_crc32_update_fn tiny_crc32c_hw_detect(void)
+{
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("sse4.2") )
+    {
+        return crc32c_sse42_update;
+    }
+    return NULL;
+}
+#endif
+
+#elif defined(TINY_CRC32_HW_SUPPORTED) && defined(__aarch64__)
+
+#include <arm_acle.h>
+#include <sys/auxv.h>
+
+#ifndef HWCAP_CRC32
+#define HWCAP_CRC32 (1 << 7)
+#endif
+
+#if defined(__clang__)
+#define TINY_TARGET_CRC __attribute__((target("crc")))
+#else
+#define TINY_TARGET_CRC __attribute__((target("+crc")))
+#endif
+
+#ifdef CONFIG_ENABLE_FCS32
+TINY_TARGET_CRC static uint32_t crc32_armv8_update(uint32_t crc, const uint8_t *buf, int size)
+{
+    while ( size >= 8 )
+    {
+        uint64_t v;
+        memcpy(&v, buf, sizeof(v));
+        crc = __crc32d(crc, v);
+        buf += 8;
+        size -= 8;
+    }
+    while ( size-- )
+    {
+        crc = __crc32b(crc, *buf++);
+    }
+    return crc;
+}
+
+tiny_crc32_update_fn tiny_crc32_hw_detect(void)
+{
+    if ( getauxval(AT_HWCAP) & HWCAP_CRC32 )
+    {
+        return crc32_armv8_update;
+    }
+    return NULL;
+}
+#endif
+
+#ifdef CONFIG_ENABLE_CRC32C
+TINY_TARGET_CRC static uint32_t crc32c_armv8_update(uint32_t crc, const uint8_t *buf, int size)
+{
+    while ( size >= 8 )
+    {
+        uint64_t v;
+        memcpy(&v, buf, sizeof(v));
+        crc = __crc32cd(crc, v);
+        buf += 8;
+        size -= 8;
+    }
+    while ( size-- )
+    {
+        crc = __crc32cb(crc, *buf++);
+    }
+    return crc;
+}
+
+tiny_crc32_update_fn tiny_crc32c_hw_detect(void)
+{
+    if ( getauxval(AT_HWCAP) & HWCAP_CRC32 )
+    {
+        return crc32c_armv8_update;
+    }
+    return NULL;
+}
+#endif
+
+#else
+
+#ifdef CONFIG_ENABLE_FCS32
+tiny_crc32_update_fn tiny_crc32_hw_detect(void)
+{
+    return NULL;
+}
+#endif
+
+#ifdef CONFIG_ENABLE_CRC32C
+tiny_crc32_update_fn tiny_crc32c_hw_detect(void)
+{
+    return NULL;
+}
+#endif
+
+#endif
@@ -0,0 +1,70 @@
+/*
+    Copyright 2025 (C) Alexey Dynda
+
+    This file is part of Tiny Protocol Library.
+
+    GNU General Public License Usage
+
+    Protocol Library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Protocol Library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with Protocol Library.  If not, see <http://www.gnu.org/licenses/>.
+
+    Commercial License Usage
+
+    Licensees holding valid commercial Tiny Protocol licenses may use this file in
+    accordance with the commercial license agreement provided in accordance with
+    the terms contained in a written agreement between you and Alexey Dynda.
+    For further information contact via email on github account.
+*/
+
+#pragma once
+
+#include "tiny_crc.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Accelerated kernels are built only for GNU-compatible compilers on x86-64 and AArch64 Linux */
+#if !defined(CONFIG_TINY_CRC_NO_HW) && (defined(__GNUC__) || defined(__clang__)) &&                                  \
+    (defined(__x86_64__) || (defined(__aarch64__) && defined(__linux__)))
+#define TINY_CRC32_HW_SUPPORTED
+#endif
+
+    typedef uint32_t (*tiny_crc32_update_fn)(uint32_t crc, const uint8_t *buf, int size);
+
+#ifdef CONFIG_ENABLE_FCS32
+    /** Table based crc32 update, always available and used as fallback */
+    uint32_t tiny_crc32_sw_update(uint32_t crc, const uint8_t *buf, int size);
+
+    /**
+     * Returns crc32 update function using cpu crc instructions (PCLMULQDQ folding on x86-64,
+     * CRC32 instructions on AArch64) or NULL if current cpu doesn't support them.
+     */
+    tiny_crc32_update_fn tiny_crc32_hw_detect(void);
+#endif
+
+#ifdef CONFIG_ENABLE_CRC32C
+    /** Table based crc32c update, always available and used as fallback */
+    uint32_t tiny_crc32c_sw_update(uint32_t crc, const uint8_t *buf, int size);
+
+    /**
+     * Returns crc32c update function using cpu crc instructions (SSE4.2 crc32 on x86-64,
+     * CRC32C instructions on AArch64) or NULL if current cpu doesn't support them.
+     */
+    tiny_crc32_update_fn tiny_crc32c_hw_detect(void);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -67,25 +67,85 @@ static inline uint32_t __time_passed_since_last_marker_seen(tiny_fd_handle_t han
 
 ///////////////////////////////////////////////////////////////////////////////
 
+static inline int __slots_maps_size(uint8_t peers_count, int window_frames)
+{
+    // Maps of N(S) to I-queue slots for all peers, the size is aligned to keep next structures aligned
+    return (peers_count * __i_queue_control_slots_size(window_frames) + TINY_ALIGN_STRUCT_VALUE - 1) &
+           ~(TINY_ALIGN_STRUCT_VALUE - 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static inline int __rx_reorder_count(const tiny_fd_init_t *init)
+{
+    // Out of order frames cannot exceed the window. HDLC has up to 32 RX slots, and two of them
+    // are left for the new frame and for the missing one (see __rx_window())
+    return init->selective_repeat ? (init->window_frames - 1 < 30 ? init->window_frames - 1 : 30) : 0;
+}
+
+static inline int __rx_window(const tiny_fd_init_t *init)
+{
+    // One slot receives new frame. Buffered out of order frames need one more slot for the missing
+    // frame, since it can be held by the application, same as frames held with tiny_fd_rx_hold().
+    return 1 + __rx_reorder_count(init) + (init->selective_repeat ? 1 : 0) + init->rx_hold_frames;
+}
+
+static inline int __align_pad(int size)
+{
+    return (int)(((size + TINY_ALIGN_STRUCT_VALUE - 1) & ~(TINY_ALIGN_STRUCT_VALUE - 1)) - size);
+}
+
+static int __tail_pads_size(const tiny_fd_init_t *init)
+{
+    // TX queues, following HDLC area, are aligned one by one, HDLC area itself ends aligned
+    const int slot_size = sizeof(tiny_fd_frame_info_t) - sizeof(((tiny_fd_frame_info_t *)0)->payload);
+    const int ext_control = init->extended_mode ? 1 : 0;
+    const int small_mtu = init->small_frames ? init->small_mtu : 0;
+    const int ui_mtu = init->ui_mtu ? init->ui_mtu : init->mtu;
+    int pads = __align_pad(init->window_frames * (slot_size + init->mtu + ext_control) -
+                           init->small_frames * (init->mtu - small_mtu)) +
+               __align_pad(TINY_FD_U_QUEUE_MAX_SIZE * sizeof(tiny_fd_frame_info_t));
+    if ( init->ui_frames )
+    {
+        pads += __align_pad(init->ui_frames * (slot_size + ui_mtu));
+    }
+    return pads;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static inline int __rx_messages_size(const tiny_fd_init_t *init)
+{
+    // Each peer has its own reassembly record, and buffer, if the user doesn't provide one
+    const int peers_count = init->peers_count ? init->peers_count : 1;
+    return init->on_message_cb ? peers_count * ( (int)sizeof(tiny_fd_rx_message_t) + (init->message_buffer ? 0 : init->message_size) ) : 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 static void __switch_to_connected_state(tiny_fd_handle_t handle, uint8_t peer)
 {
     if ( handle->peers[peer].state != TINY_FD_STATE_CONNECTED )
     {
         handle->peers[peer].state = TINY_FD_STATE_CONNECTED;
         __reset_i_queue_control(&handle->peers[peer].i_queue_control);
+        __drop_reordered_frames(handle, peer);
+        __drop_partial_message(handle, peer);
         handle->peers[peer].sent_nr = 0;
         handle->peers[peer].sent_reject = 0;
-        handle->peers[peer].srej_req_mask = 0;
-        tiny_fd_queue_reset_for( &handle->frames.i_queue, __peer_to_address_field( handle, peer ) );
+        handle->peers[peer].rx_withheld = 0;
+        handle->peers[peer].srej_pending = 0;
+        handle->peers[peer].remote_busy = 0;
+        handle->peers[peer].checkpoint_ns = FD_NO_CHECKPOINT;
+        __reset_rto(handle, peer);
+        __reset_i_frames( handle, peer );
         // Reset last arrived frame timestamp on connection.
         // This is required to avoid disconnection on keep alive timeout at the beginning of connection
         handle->peers[peer].last_received_frame_ts = tiny_millis();
         handle->peers[peer].last_sent_frame_ts = tiny_millis();
         tiny_events_set(&handle->peers[peer].events, FD_EVENT_CAN_ACCEPT_I_FRAMES);
-        tiny_events_set(
-            &handle->events,
-            FD_EVENT_TX_DATA_AVAILABLE |
-                (tiny_fd_queue_has_free_slots(&handle->frames.i_queue) ? FD_EVENT_QUEUE_HAS_FREE_SLOTS : 0));
+        tiny_events_set(&handle->events, FD_EVENT_TX_DATA_AVAILABLE);
+        __update_i_queue_free_slots_events( handle );
         LOG(TINY_LOG_WRN, "[%p] Connection is established\n", handle);
         if ( handle->on_connect_event_cb )
         {
@@ -106,10 +166,15 @@ static void __switch_to_disconnected_state(tiny_fd_handle_t handle, uint8_t peer
     {
         handle->peers[peer].state = TINY_FD_STATE_DISCONNECTED;
         __reset_i_queue_control(&handle->peers[peer].i_queue_control);
+        __drop_reordered_frames(handle, peer);
+        __drop_partial_message(handle, peer);
         handle->peers[peer].sent_nr = 0;
         handle->peers[peer].sent_reject = 0;
-        handle->peers[peer].srej_req_mask = 0;
-        tiny_fd_queue_reset_for( &handle->frames.i_queue, __peer_to_address_field( handle, peer ) );
+        handle->peers[peer].rx_withheld = 0;
+        handle->peers[peer].srej_pending = 0;
+        handle->peers[peer].remote_busy = 0;
+        handle->peers[peer].checkpoint_ns = FD_NO_CHECKPOINT;
+        __reset_i_frames( handle, peer );
         tiny_events_clear(&handle->peers[peer].events, FD_EVENT_CAN_ACCEPT_I_FRAMES);
         LOG(TINY_LOG_CRIT, "[%p] Disconnected\n", handle);
         if ( handle->on_connect_event_cb )
@@ -126,10 +191,11 @@ static void __switch_to_disconnected_state(tiny_fd_handle_t handle, uint8_t peer
 
 ///////////////////////////////////////////////////////////////////////////////
 
+// Called by hdlc_ll_run_rx() with frames.mutex locked
 static void on_frame_read(void *user_data, uint8_t *data, int len)
 {
     tiny_fd_handle_t handle = (tiny_fd_handle_t)user_data;
-    if ( len < 2 )
+    if ( len < 2 || len < __frame_header_size( handle, data ) )
     {
         LOG(TINY_LOG_WRN, "%s: received too small frame\n", "FD");
         return;
@@ -141,7 +207,6 @@ static void on_frame_read(void *user_data, uint8_t *data, int len)
         // it seems that the frame is not for us. Just exit
         return;
     }
-    tiny_mutex_lock(&handle->frames.mutex);
     handle->peers[peer].last_received_frame_ts = tiny_millis();
     handle->peers[peer].ka_confirmed = 1;
     uint8_t control = ((uint8_t *)data)[1];
@@ -174,7 +239,7 @@ static void on_frame_read(void *user_data, uint8_t *data, int len)
     // Check that if we are in NRM mode then we have something to send
     if ( handle->mode == TINY_FD_MODE_NRM )
     {
-        if ( control & ( HDLC_P_BIT | HDLC_F_BIT ) )
+        if ( __frame_pf( handle, data ) )
         {
             LOG(TINY_LOG_INFO, "[%p] [CAPTURED MARKER]\n", handle);
             // Cool! Now we have marker again, and we can send
@@ -190,9 +255,9 @@ static void on_frame_read(void *user_data, uint8_t *data, int len)
             //       2.1. The last one should have final bit set
         }
     }
-    tiny_mutex_unlock(&handle->frames.mutex);
 }
 
+// Called by hdlc level with frames.mutex locked
 static void on_frame_send(void *user_data, const uint8_t *data, int len)
 {
     tiny_fd_handle_t handle = (tiny_fd_handle_t)user_data;
@@ -203,23 +268,41 @@ static void on_frame_send(void *user_data, const uint8_t *data, int len)
         // Do nothing for now, but this should never happen
         return;
     }
-    tiny_mutex_lock(&handle->frames.mutex);
+    tiny_fd_frame_info_t *frame = tiny_fd_queue_get_by_header( data );
     if ( (control & HDLC_I_FRAME_MASK) == HDLC_I_FRAME_BITS )
     {
-        (void)(peer);
-        // nothing to do
-        // we need to wait for confirmation from remote side
+        // Wait for confirmation from remote side, unless the peer was reset while the frame was being sent
+        if ( frame->type == TINY_FD_QUEUE_SENDING )
+        {
+            tiny_fd_queue_free( &handle->frames.i_queue, frame );
+        }
     }
     else if ( (control & HDLC_S_FRAME_MASK) == HDLC_S_FRAME_BITS )
     {
-        tiny_fd_queue_free_by_header( &handle->frames.s_queue, data );
+        if ( handle->tx_purge )
+        {
+            frame->type = TINY_FD_QUEUE_S_FRAME;
+        }
+        else
+        {
+            tiny_fd_queue_free( &handle->frames.s_queue, frame );
+        }
     }
     else if ( (control & HDLC_U_FRAME_MASK) == HDLC_U_FRAME_BITS )
     {
-        tiny_fd_queue_free_by_header( &handle->frames.s_queue, data );
+        const bool ui = (control & HDLC_U_FRAME_TYPE_MASK) == HDLC_U_FRAME_TYPE_UI;
+        if ( handle->tx_purge )
+        {
+            frame->type = ui ? TINY_FD_QUEUE_UI_FRAME : TINY_FD_QUEUE_U_FRAME;
+        }
+        else
+        {
+            tiny_fd_queue_free( ui ? __get_ui_queue( handle ) : &handle->frames.s_queue, frame );
+        }
     }
     // Clear send flag and clear marker if final was transferred. For ABM mode the marker is never cleared
-    uint8_t flags_to_clear = FD_EVENT_TX_SENDING;
+    // Send flag stays set, while hdlc level has queued frames to send
+    uint8_t flags_to_clear = handle->_hdlc->tx.origin_data ? 0 : FD_EVENT_TX_SENDING;
     if ( handle->mode == TINY_FD_MODE_NRM )
     {
         // Let's talk to the next station if we are primary
@@ -227,25 +310,24 @@ static void on_frame_send(void *user_data, const uint8_t *data, int len)
         // from the peer we provided the marker to... But what? What if
         // remote peer never responds to us. So, having switch procedure
         // in this callback simplifies things
-        if ( __is_primary_station( handle ) && (control & HDLC_P_BIT) )
+        if ( __is_primary_station( handle ) && __frame_pf( handle, data ) )
         {
             __switch_to_next_peer( handle );
             LOG(TINY_LOG_INFO, "[%p] [RELEASED MARKER]\n", handle);
             flags_to_clear |= FD_EVENT_HAS_MARKER;
         }
-        else if ( !__is_primary_station( handle ) && (control & HDLC_F_BIT) )
+        else if ( !__is_primary_station( handle ) && __frame_pf( handle, data ) )
         {
             LOG(TINY_LOG_INFO, "[%p] [RELEASED MARKER]\n", handle);
             flags_to_clear |= FD_EVENT_HAS_MARKER;
         }
     }
     tiny_events_clear( &handle->events, flags_to_clear );
-    tiny_mutex_unlock( &handle->frames.mutex );
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-static int __tiny_fd_init_validate(tiny_fd_handle_t *handle, tiny_fd_init_t *init, uint8_t peers_count)
+static int __tiny_fd_init_validate(tiny_fd_handle_t *handle, tiny_fd_init_t *init)
 {
     *handle = NULL;
     if ( (0 == init->on_read_cb) || (0 == init->buffer) || (0 == init->buffer_size) )
@@ -253,31 +335,75 @@ static int __tiny_fd_init_validate(tiny_fd_handle_t *handle, tiny_fd_init_t *ini
         LOG(TINY_LOG_CRIT, "Invalid input data: null pointers%s", "\n");
         return TINY_ERR_INVALID_DATA;
     }
+    if ( init->window_frames < 2 )
+    {
+        LOG(TINY_LOG_CRIT, "HDLC doesn't support less than 2-frames queue%s", "\n");
+        return TINY_ERR_INVALID_DATA;
+    }
+    const uint8_t seq_mask = init->extended_mode ? HDLC_EXT_SEQ_MASK : HDLC_SEQ_MASK;
+    if ( init->window_frames > seq_mask )
+    {
+        LOG(TINY_LOG_CRIT, "Window size %d exceeds sequence space %d\n",
+            init->window_frames, seq_mask + 1);
+        return TINY_ERR_INVALID_DATA;
+    }
+    if ( init->selective_repeat && init->window_frames > (seq_mask + 1) / 2 )
+    {
+        LOG(TINY_LOG_CRIT, "Selective repeat requires window size %d not more than %d\n",
+            init->window_frames, (seq_mask + 1) / 2);
+        return TINY_ERR_INVALID_DATA;
+    }
+    if ( __rx_window(init) > 32 )
+    {
+        LOG(TINY_LOG_CRIT, "Only 32 RX slots can be held, %i are required\n", __rx_window(init));
+        return TINY_ERR_INVALID_DATA;
+    }
+    if ( init->small_frames && (init->small_frames >= init->window_frames || init->small_mtu <= 0) )
+    {
+        LOG(TINY_LOG_CRIT, "Invalid small tx slots configuration: %i slots of %i bytes\n", init->small_frames, init->small_mtu);
+        return TINY_ERR_INVALID_DATA;
+    }
+    if ( init->ui_mtu < 0 )
+    {
+        LOG(TINY_LOG_CRIT, "Invalid UI queue mtu %i\n", init->ui_mtu);
+        return TINY_ERR_INVALID_DATA;
+    }
     if ( init->mtu == 0 )
     {
-        int size = tiny_fd_buffer_size_by_mtu_ex(peers_count, 0, init->window_frames, init->crc_type, 1);
-        init->mtu = (init->buffer_size - size) / (init->window_frames + 1);
+        // UI slots without explicit ui_mtu take mtu bytes each, as full-size tx slots do
+        int size = tiny_fd_buffer_size_by_init(init);
+        init->mtu = (init->buffer_size - size) /
+                    (init->window_frames - init->small_frames + __rx_window(init) + (init->ui_mtu ? 0 : init->ui_frames));
+        // Alignment padding of TX queues depends on mtu
+        while ( init->mtu >= 2 && tiny_fd_buffer_size_by_init(init) > init->buffer_size )
+        {
+            init->mtu--;
+        }
         if ( init->mtu < 2 )
         {
             LOG(TINY_LOG_CRIT, "Calculated mtu size is zero, no payload transfer is available%s", "\n");
             return TINY_ERR_OUT_OF_MEMORY;
         }
     }
-    if ( init->buffer_size < tiny_fd_buffer_size_by_mtu_ex(peers_count, init->mtu, init->window_frames, init->crc_type, 1) )
+    if ( init->small_frames && init->small_mtu >= init->mtu )
     {
-        LOG(TINY_LOG_CRIT, "Too small buffer for FD protocol %i < %i\n", init->buffer_size,
-            tiny_fd_buffer_size_by_mtu_ex(peers_count, init->mtu, init->window_frames, init->crc_type, 1));
+        LOG(TINY_LOG_CRIT, "Small tx slots mtu %i must be less than mtu %i\n", init->small_mtu, init->mtu);
+        return TINY_ERR_INVALID_DATA;
+    }
+    int required_size = tiny_fd_buffer_size_by_init(init);
+    if ( init->buffer_size < required_size )
+    {
+        LOG(TINY_LOG_CRIT, "Too small buffer for FD protocol %i < %i\n", init->buffer_size, required_size);
         return TINY_ERR_OUT_OF_MEMORY;
     }
-    if ( init->window_frames < 2 )
+    if ( init->on_message_cb && (init->message_size <= 0 || init->mtu <= FD_MESSAGE_HEADER_SIZE) )
     {
-        LOG(TINY_LOG_CRIT, "HDLC doesn't support less than 2-frames queue%s", "\n");
+        LOG(TINY_LOG_CRIT, "Messages require message_size and mtu more than %d\n", FD_MESSAGE_HEADER_SIZE);
         return TINY_ERR_INVALID_DATA;
     }
-    if ( init->window_frames > seq_bits_mask )  // ADD THIS CHECK
+    if ( init->rto_max && init->rto_min > init->rto_max )
     {
-        LOG(TINY_LOG_CRIT, "Window size %d exceeds sequence space %d\n", 
-            init->window_frames, seq_bits_mask + 1);
+        LOG(TINY_LOG_CRIT, "Invalid retransmission timeout bounds %u > %u\n", init->rto_min, init->rto_max);
         return TINY_ERR_INVALID_DATA;
     }
     if ( !init->retry_timeout && !init->send_timeout )
@@ -294,12 +420,18 @@ int tiny_fd_init(tiny_fd_handle_t *handle, tiny_fd_init_t *init)
 {
     const uint8_t peers_count = init->peers_count == 0 ? 1 : init->peers_count;
     {
-        int result = __tiny_fd_init_validate(handle, init, peers_count);
+        int result = __tiny_fd_init_validate(handle, init);
         if (result != TINY_SUCCESS)
         {
             return result;
         }
     }
+    const int small_mtu = init->small_frames ? init->small_mtu : 0;
+    const int ui_mtu = init->ui_mtu ? init->ui_mtu : init->mtu;
+    // In extended mode I-queue slots keep the second byte of control field ahead of user payload
+    const uint8_t ext_control = init->extended_mode ? 1 : 0;
+    const uint8_t seq_mask = init->extended_mode ? HDLC_EXT_SEQ_MASK : HDLC_SEQ_MASK;
+    const int slots_size = __i_queue_control_slots_size(init->window_frames);
     memset(init->buffer, 0, init->buffer_size);
 
     /* Lets locate main FD protocol data at the beginning of specified buffer.
@@ -308,25 +440,34 @@ int tiny_fd_init(tiny_fd_handle_t *handle, tiny_fd_init_t *init)
     uint8_t *ptr = TINY_ALIGN_BUFFER(init->buffer);
     tiny_fd_data_t *protocol = (tiny_fd_data_t *)ptr;
     ptr += sizeof(tiny_fd_data_t);
-    /* Next let's allocate the space for low level hdlc structure. It will be located right next to the tiny_fd_data_t.
+    /* Each peer has map of N(S) to I-queue slots, all maps are located right after tiny_fd_data_t */
+    uint8_t *slots = ptr;
+    ptr += __slots_maps_size(peers_count, init->window_frames);
+    /* Next let's allocate the space for low level hdlc structure. It will be located right next to the slots maps.
      * To do that we need to calculate the size required for all FD buffers
      * We do not need to align the buffer for the HDLC level, since it done by low level API. */
     uint8_t *hdlc_ll_ptr = ptr;
-    // TODO: Hack: remove - 4
-    int hdlc_ll_size = (int)((uint8_t *)init->buffer + init->buffer_size - ptr - 4 - // Remaining size
-                             init->window_frames *                               // Number of frames multiply by frame size (headers + payload + pointers)
-                                 ( sizeof(tiny_fd_frame_info_t *) + init->mtu + sizeof(tiny_fd_frame_info_t) - sizeof(((tiny_fd_frame_info_t *)0)->payload) ) -
-                             TINY_FD_U_QUEUE_MAX_SIZE *
-                                 (sizeof(tiny_fd_frame_info_t *) + sizeof(tiny_fd_frame_info_t)) -
-                             peers_count * sizeof(tiny_fd_peer_info_t));
+    int hdlc_ll_size = (int)((uint8_t *)init->buffer + init->buffer_size - ptr -    // Remaining size
+                             __tail_pads_size(init) -
+                             init->window_frames *                               // Number of frames multiply by frame size (headers + payload)
+                                 ( init->mtu + ext_control + sizeof(tiny_fd_frame_info_t) - sizeof(((tiny_fd_frame_info_t *)0)->payload) ) +
+                             init->small_frames * ( init->mtu - small_mtu ) -                // Small frame slots take less space
+                             TINY_FD_U_QUEUE_MAX_SIZE * sizeof(tiny_fd_frame_info_t) -
+                             (init->ui_frames ? sizeof(tiny_fd_queue_t) : 0) -
+                             init->ui_frames *
+                                 ( ui_mtu + sizeof(tiny_fd_frame_info_t) - sizeof(((tiny_fd_frame_info_t *)0)->payload) ) -
+                             peers_count * sizeof(tiny_fd_peer_info_t) -
+                             __rx_reorder_count(init) * sizeof(tiny_fd_rx_frame_t) -
+                             __rx_messages_size(init));
     /* All FD protocol structures must be aligned. */
     hdlc_ll_size &= ~(TINY_ALIGN_STRUCT_VALUE - 1);
     ptr += hdlc_ll_size;
     ptr = TINY_ALIGN_BUFFER(ptr);
 
-    /* Next we need some space to hold pointers to tiny_i_frame_info_t records (window_frames pointers) */
-    int queue_size = tiny_fd_queue_init( &protocol->frames.i_queue, ptr, (int)((uint8_t *)init->buffer + init->buffer_size - ptr),
-                                         init->window_frames, init->mtu );
+    /* Next we need some space to hold I-frames (window_frames slots) */
+    int queue_size = tiny_fd_queue_init_ex( &protocol->frames.i_queue, ptr, (int)((uint8_t *)init->buffer + init->buffer_size - ptr),
+                                            init->window_frames, init->mtu + ext_control, init->small_frames,
+                                            small_mtu ? small_mtu + ext_control : 0 );
     if ( queue_size < 0 )
     {
         return queue_size;
@@ -340,6 +481,21 @@ int tiny_fd_init(tiny_fd_handle_t *handle, tiny_fd_init_t *init)
         return queue_size;
     }
     ptr += queue_size;
+    /* UI frames get their own queue only if requested, otherwise they share s_queue */
+    protocol->frames.ui_queue = &protocol->frames.s_queue;
+    if ( init->ui_frames )
+    {
+        ptr = TINY_ALIGN_BUFFER(ptr);
+        protocol->frames.ui_queue = (tiny_fd_queue_t *)ptr;
+        ptr += sizeof(tiny_fd_queue_t);
+        queue_size = tiny_fd_queue_init( protocol->frames.ui_queue, ptr, (int)((uint8_t *)init->buffer + init->buffer_size - ptr),
+                                         init->ui_frames, ui_mtu );
+        if ( queue_size < 0 )
+        {
+            return queue_size;
+        }
+        ptr += queue_size;
+    }
 
     /* Next we allocate some space for peer-related data */
     ptr = TINY_ALIGN_BUFFER(ptr);
@@ -348,6 +504,24 @@ int tiny_fd_init(tiny_fd_handle_t *handle, tiny_fd_init_t *init)
     protocol->next_peer = 0;
     ptr += sizeof(tiny_fd_peer_info_t) * peers_count;
 
+    /* Records of out of order frames are needed only for selective repeat, they follow peers data */
+    protocol->rx_reorder_count = __rx_reorder_count(init);
+    protocol->rx_low_water = init->rx_low_water;
+    ptr += sizeof(tiny_fd_rx_frame_t) * protocol->rx_reorder_count;
+
+    /* Records of messages being reassembled follow them, reassembly buffers are the last ones */
+    tiny_fd_rx_message_t *messages = (tiny_fd_rx_message_t *)ptr;
+    if ( init->on_message_cb )
+    {
+        uint8_t *message_buffer = init->message_buffer ? init->message_buffer : ptr + sizeof(tiny_fd_rx_message_t) * peers_count;
+        for ( uint8_t peer = 0; peer < peers_count; peer++ )
+        {
+            messages[peer].data = message_buffer + peer * init->message_size;
+            messages[peer].size = init->message_size;
+        }
+        ptr += __rx_messages_size(init);
+    }
+
     if ( ptr > (uint8_t *)init->buffer + init->buffer_size )
     {
         LOG(TINY_LOG_CRIT, "Out of provided memory: provided %i bytes, used %i bytes\n", init->buffer_size,
@@ -360,9 +534,12 @@ int tiny_fd_init(tiny_fd_handle_t *handle, tiny_fd_init_t *init)
     _init.on_frame_send = on_frame_send;
     _init.user_data = protocol;
     _init.crc_type = init->crc_type;
+    _init.framing = init->framing;
+    _init.tx_queue_size = init->tx_queue_size;
+    _init.shared_flag = init->shared_flag;
     _init.buf_size = hdlc_ll_size;
     _init.buf = hdlc_ll_ptr;
-    _init.mtu = init->mtu + sizeof(tiny_frame_header_t);
+    _init.mtu = init->mtu + sizeof(tiny_frame_header_t) + ext_control;
 
     int result = hdlc_ll_init(&protocol->_hdlc, &_init);
     if ( result != TINY_SUCCESS )
@@ -372,7 +549,9 @@ int tiny_fd_init(tiny_fd_handle_t *handle, tiny_fd_init_t *init)
     }
 
     protocol->user_data = init->pdata;
-    protocol->on_read_cb = init->on_read_cb;
+    // I-frames are passed to the user either as is, or as reassembled messages
+    protocol->on_read_cb = init->on_message_cb ? init->on_message_cb : init->on_read_cb;
+    protocol->messages = init->on_message_cb != NULL;
     protocol->on_send_cb = init->on_send_cb;
     protocol->on_read_ui_cb = init->on_read_ui_cb;
     protocol->on_connect_event_cb = init->on_connect_event_cb;
@@ -381,10 +560,21 @@ int tiny_fd_init(tiny_fd_handle_t *handle, tiny_fd_init_t *init)
     // By default assign primary address
     protocol->addr = (init->addr ? (init->addr << 2) : HDLC_PRIMARY_ADDR ) | HDLC_E_BIT;
     protocol->mode = init->mode;
+    protocol->ext_control = ext_control;
     // Primary devices always have markers
     protocol->ka_timeout = 5000;
     protocol->retry_timeout = init->retry_timeout ? init->retry_timeout : (protocol->send_timeout / (init->retries + 1));
     protocol->retries = init->retries;
+    protocol->rto_min = init->rto_min ? init->rto_min : 1;
+    protocol->rto_max = init->rto_max;
+    // Remote side should not wait for acknowledgement with more than half of the window unconfirmed
+    protocol->ack_delay = init->ack_delay;
+    protocol->checkpointing = init->checkpointing && protocol->mode == TINY_FD_MODE_ABM;
+    protocol->ack_frames = ( !init->ack_frames || init->ack_frames > init->window_frames / 2 ) ? init->window_frames / 2
+                                                                                               : init->ack_frames;
+    protocol->peer_tx_quota = init->peer_tx_quota;
+    // Only primary station schedules the marker among peers in NRM mode
+    protocol->peer_quantum = ( __is_primary_station( protocol ) && protocol->mode == TINY_FD_MODE_NRM ) ? init->peer_quantum : 0;
     for (uint8_t peer = 0; peer < protocol->peers_count; peer++ )
     {
         protocol->peers[peer].retries = init->retries;
@@ -400,14 +590,19 @@ int tiny_fd_init(tiny_fd_handle_t *handle, tiny_fd_init_t *init)
             protocol->peers[peer].addr = HDLC_INVALID_PEER_INDEX;
         }
         protocol->peers[peer].state = TINY_FD_STATE_DISCONNECTED;
+        protocol->peers[peer].deficit = peer ? 0 : protocol->peer_quantum;
+        protocol->peers[peer].reserved_slot = I_QUEUE_CONTROL_NO_SLOT;
+        protocol->peers[peer].checkpoint_ns = FD_NO_CHECKPOINT;
+        __reset_rto(protocol, peer);
+        __init_i_queue_control(&protocol->peers[peer].i_queue_control, seq_mask, slots + peer * slots_size, slots_size);
         tiny_events_create(&protocol->peers[peer].events);
     }
 
     tiny_mutex_create(&protocol->frames.mutex);
     tiny_events_create(&protocol->events);
     // Primary station has marker by default
-    tiny_events_set( &protocol->events, FD_EVENT_QUEUE_HAS_FREE_SLOTS |
-                                        (__is_primary_station( protocol ) ? FD_EVENT_HAS_MARKER : 0) );
+    tiny_events_set( &protocol->events, __is_primary_station( protocol ) ? FD_EVENT_HAS_MARKER : 0 );
+    __update_i_queue_free_slots_events( protocol );
     *handle = protocol;
 
     return TINY_SUCCESS;
@@ -417,7 +612,9 @@ int tiny_fd_init(tiny_fd_handle_t *handle, tiny_fd_init_t *init)
 
 void tiny_fd_close(tiny_fd_handle_t handle)
 {
+    tiny_mutex_lock(&handle->frames.mutex);
     hdlc_ll_close(handle->_hdlc);
+    tiny_mutex_unlock(&handle->frames.mutex);
     for (uint8_t peer = 0; peer < handle->peers_count; peer++ )
     {
         tiny_events_destroy(&handle->peers[peer].events);
@@ -434,7 +631,10 @@ int tiny_fd_on_rx_data(tiny_fd_handle_t handle, const void *data, int len)
     while ( len )
     {
         int error;
+        // HDLC level looks for the next RX slot, not held by tiny_fd_rx_hold(), so lock against tiny_fd_rx_release()
+        tiny_mutex_lock(&handle->frames.mutex);
         int processed_bytes = hdlc_ll_run_rx(handle->_hdlc, ptr, len, &error);
+        tiny_mutex_unlock(&handle->frames.mutex);
         if ( error == TINY_ERR_WRONG_CRC )
         {
             LOG(TINY_LOG_WRN, "[%p] HDLC CRC sum mismatch\n", handle);
@@ -460,7 +660,86 @@ int tiny_fd_run_rx(tiny_fd_handle_t handle, read_block_cb_t read_func)
 
 ///////////////////////////////////////////////////////////////////////////////
 
-static uint8_t *tiny_fd_get_next_i_frame(tiny_fd_handle_t handle, int *len, uint8_t peer, uint8_t address)
+int tiny_fd_rx_hold(tiny_fd_handle_t handle, const uint8_t *buf)
+{
+    if ( handle == NULL || buf == NULL )
+    {
+        return TINY_ERR_INVALID_DATA;
+    }
+    tiny_mutex_lock(&handle->frames.mutex);
+    int result = hdlc_ll_rx_hold( handle->_hdlc, buf );
+    if ( result == TINY_SUCCESS && !handle->local_busy && hdlc_ll_rx_free_slots( handle->_hdlc ) <= handle->rx_low_water )
+    {
+        // Soon next I-frames would be dropped, so ask peers to wait
+        LOG(TINY_LOG_WRN, "[%p] RX slots are on loan, sending RNR\n", handle);
+        handle->local_busy = 1;
+        for ( uint8_t peer = 0; peer < handle->peers_count; peer++ )
+        {
+            if ( handle->peers[peer].state == TINY_FD_STATE_CONNECTED )
+            {
+                __put_s_frame_to_tx_queue(handle, __peer_to_address_field( handle, peer ), HDLC_S_FRAME_TYPE_RNR,
+                                          __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control), false);
+            }
+        }
+    }
+    tiny_mutex_unlock(&handle->frames.mutex);
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int tiny_fd_rx_release(tiny_fd_handle_t handle, const uint8_t *buf)
+{
+    if ( handle == NULL || buf == NULL )
+    {
+        return TINY_ERR_INVALID_DATA;
+    }
+    tiny_mutex_lock(&handle->frames.mutex);
+    int result = hdlc_ll_rx_release( handle->_hdlc, buf );
+    const uint8_t was_busy = result == TINY_SUCCESS && handle->local_busy &&
+                             hdlc_ll_rx_free_slots( handle->_hdlc ) > handle->rx_low_water;
+    if ( was_busy )
+    {
+        LOG(TINY_LOG_INFO, "[%p] RX slots are released, sending RR\n", handle);
+        handle->local_busy = 0;
+    }
+    // Any S-frame, except RNR, clears busy condition on remote side, so wait for free slots
+    for ( uint8_t peer = 0; result == TINY_SUCCESS && !handle->local_busy && peer < handle->peers_count; peer++ )
+    {
+        if ( handle->peers[peer].rx_withheld )
+        {
+            // Ask remote side to retransmit frames, dropped while RX slots were on loan
+            handle->peers[peer].rx_withheld = 0;
+            __put_s_frame_to_tx_queue(handle, __peer_to_address_field( handle, peer ), HDLC_S_FRAME_TYPE_REJ,
+                                      __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control), false);
+        }
+        else if ( was_busy && handle->peers[peer].state == TINY_FD_STATE_CONNECTED )
+        {
+            // Clear busy condition, signalled by RNR
+            __put_s_frame_to_tx_queue(handle, __peer_to_address_field( handle, peer ), HDLC_S_FRAME_TYPE_RR,
+                                      __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control), false);
+        }
+    }
+    tiny_mutex_unlock(&handle->frames.mutex);
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static bool __next_i_frame_fits_deficit(tiny_fd_handle_t handle, uint8_t peer)
+{
+    if ( !handle->peer_quantum )
+    {
+        return true;
+    }
+    tiny_fd_frame_info_t *ptr = __get_i_frame_from_tx_queue(
+        handle, peer, __i_queue_control_get_next_frame_to_send(&handle->peers[peer].i_queue_control) );
+    return ptr == NULL || ptr->len <= handle->peers[peer].deficit;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static uint8_t *tiny_fd_get_next_i_frame(tiny_fd_handle_t handle, int *len, uint8_t peer)
 {
     uint8_t *data = NULL;
     tiny_fd_frame_info_t *ptr = NULL;
@@ -469,59 +748,65 @@ static uint8_t *tiny_fd_get_next_i_frame(tiny_fd_handle_t handle, int *len, uint
         // If sending of I-frames is not allowed then just exit
         return NULL;
     }
+    if ( handle->peers[peer].remote_busy )
+    {
+        // Peer cannot accept I-frames, it is polled by RR until it is ready
+        return NULL;
+    }
     // Check for SREJ-requested selective retransmissions first
-    if ( handle->peers[peer].srej_req_mask != 0 )
+    if ( handle->peers[peer].srej_pending )
     {
-        for ( uint8_t i = 0; i < 8; i++ )
+        ptr = __get_requested_i_frame_from_tx_queue( handle, peer );
+        if ( ptr != NULL )
         {
-            if ( handle->peers[peer].srej_req_mask & (1 << i) )
-            {
-                ptr = tiny_fd_queue_get_next( &handle->frames.i_queue, TINY_FD_QUEUE_I_FRAME, address, i );
-                handle->peers[peer].srej_req_mask &= ~(1 << i);
-                if ( ptr != NULL )
-                {
-                    data = (uint8_t *)&ptr->header;
-                    *len = ptr->len + sizeof(tiny_frame_header_t);
-                    LOG(TINY_LOG_INFO, "[%p] SREJ retransmit I-Frame N(S)=%02X with address [%02X]\n", handle, i, data[0]);
-                    ptr->header.control &= 0x0F;
-                    ptr->header.control |= ( __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control) << 5);
-                    handle->peers[peer].sent_nr = __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control);
-                    handle->peers[peer].last_sent_i_ts = tiny_millis();
-                }
-                break;
-            }
+            data = (uint8_t *)&ptr->header;
+            *len = ptr->len + sizeof(tiny_frame_header_t);
+            LOG(TINY_LOG_INFO, "[%p] SREJ retransmit I-Frame N(S)=%02X with address [%02X]\n", handle,
+                __frame_ns( handle, data ), data[0]);
+            __frame_set_nr( handle, data, __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control) );
+            handle->peers[peer].sent_nr = __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control);
+            handle->peers[peer].last_sent_i_ts = tiny_millis();
+            return data;
         }
-        return data;
     }
-    ptr = tiny_fd_queue_get_next( &handle->frames.i_queue, TINY_FD_QUEUE_I_FRAME, address, __i_queue_control_get_next_frame_to_send(&handle->peers[peer].i_queue_control) );
+    if ( !__next_i_frame_fits_deficit( handle, peer ) )
+    {
+        // Peer has used its quantum for this marker turn, the rest of frames wait for the next turn
+        return NULL;
+    }
+    ptr = __get_i_frame_from_tx_queue( handle, peer, __i_queue_control_get_next_frame_to_send(&handle->peers[peer].i_queue_control) );
     if ( ptr != NULL )
     {
+        if ( handle->peer_quantum )
+        {
+            handle->peers[peer].deficit -= ptr->len;
+        }
         data = (uint8_t *)&ptr->header;
         *len = ptr->len + sizeof(tiny_frame_header_t);
         LOG(TINY_LOG_INFO, "[%p] Sending I-Frame N(R-awaiting)=%02X,N(S-seq sent)=%02X with address [%02X] to %s\n", handle,
             __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control),
             __i_queue_control_get_next_frame_to_send(&handle->peers[peer].i_queue_control), data[0], __is_primary_station( handle ) ? "secondary" : "primary" );
-        ptr->header.control &= 0x0F;
-        ptr->header.control |= ( __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control) << 5);
+        __frame_set_nr( handle, data, __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control) );
         __i_queue_control_move_to_next_ns(&handle->peers[peer].i_queue_control);
         // Move to different place
         handle->peers[peer].sent_nr = __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control);
         handle->peers[peer].last_sent_i_ts = tiny_millis();
+        __start_rtt_measurement(handle, peer);
     }
     return data;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
+// Called with frames.mutex locked
 static uint8_t *tiny_fd_get_next_frame_to_send(tiny_fd_handle_t handle, int *len, uint8_t peer)
 {
     uint8_t *data = NULL;
-    tiny_mutex_lock(&handle->frames.mutex);
     const uint8_t address = __peer_to_address_field( handle, peer );
     data = tiny_fd_get_next_s_u_frame_to_send(handle, len, peer, address);
     if ( data == NULL )
     {
-        data = tiny_fd_get_next_i_frame(handle, len, peer, address);
+        data = tiny_fd_get_next_i_frame(handle, len, peer);
     }
     if ( data == NULL && handle->mode == TINY_FD_MODE_NRM )
     {
@@ -532,53 +817,59 @@ static uint8_t *tiny_fd_get_next_frame_to_send(tiny_fd_handle_t handle, int *len
         {
             tiny_frame_header_t frame = {
                 .address = address | HDLC_CR_BIT,
-                .control = HDLC_U_FRAME_TYPE_SNRM | HDLC_U_FRAME_BITS,
+                .control = __set_mode_frame_type( handle ) | HDLC_U_FRAME_BITS,
             };
             __put_u_s_frame_to_tx_queue(handle, TINY_FD_QUEUE_S_FRAME, &frame, 2);
         }
         else
         {
-            tiny_frame_header_t frame = {
-                .address = address,
-                .control = HDLC_S_FRAME_BITS | HDLC_S_FRAME_TYPE_RR |
-                    (__i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control) << 5),
-            };
-            __put_u_s_frame_to_tx_queue(handle, TINY_FD_QUEUE_S_FRAME, &frame, 2);
+            __put_s_frame_to_tx_queue(handle, address, __rx_ready_frame_type( handle ),
+                                      __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control), false);
         }
         data = tiny_fd_get_next_s_u_frame_to_send(handle, len, peer, address);
     }
     if ( data != NULL )
     {
         tiny_frame_header_t *header = (tiny_frame_header_t *)data;
+        // In extended mode P/F bit of I- and S-frames is in the second byte of control field
         if ( handle->mode == TINY_FD_MODE_NRM )
         {
             // NRM: P/F on last frame only. S/U frames always get P/F (marker passing).
-            // I-frames get P/F only when no more I-frames remain for this peer.
+            // I-frames get P/F only when no more I-frames remain for this peer, or
+            // the next I-frame doesn't fit peer's deficit for this marker turn.
             if ( (header->control & HDLC_I_FRAME_MASK) == HDLC_I_FRAME_BITS )
             {
-                if ( __all_frames_are_sent(&handle->peers[peer].i_queue_control) )
+                if ( __all_frames_are_sent(&handle->peers[peer].i_queue_control) ||
+                     !__next_i_frame_fits_deficit( handle, peer ) )
                 {
-                    header->control |= HDLC_P_BIT;
+                    __frame_set_pf( handle, data );
                 }
             }
             else
             {
-                header->control |= HDLC_P_BIT;
+                __frame_set_pf( handle, data );
             }
         }
         else
         {
-            // ABM: Set P/F only on U-frames (SABM, DISC, UA, DM always use P/F)
+            // ABM: Set P/F on U-frames (SABM, DISC, UA, DM always use P/F)
             if ( (header->control & HDLC_U_FRAME_MASK) == HDLC_U_FRAME_BITS )
             {
                 header->control |= HDLC_P_BIT;
             }
+            // Checkpoint: the last I-frame, which can be sent, polls the peer for immediate answer.
+            // Only one checkpoint can be outstanding.
+            else if ( handle->checkpointing && (header->control & HDLC_I_FRAME_MASK) == HDLC_I_FRAME_BITS &&
+                      handle->peers[peer].checkpoint_ns == FD_NO_CHECKPOINT && __all_frames_are_sent(&handle->peers[peer].i_queue_control) )
+            {
+                __frame_set_pf( handle, data );
+                handle->peers[peer].checkpoint_ns = __i_queue_control_get_next_frame_to_send(&handle->peers[peer].i_queue_control);
+            }
         }
         handle->last_marker_ts = tiny_millis();
         handle->peers[peer].last_sent_frame_ts = tiny_millis();
         __tiny_fd_log_frame(handle, TINY_FD_FRAME_DIRECTION_OUT, data, *len);
     }
-    tiny_mutex_unlock(&handle->frames.mutex);
     return data;
 }
 
@@ -588,10 +879,18 @@ static void tiny_fd_connected_check_idle_timeout(tiny_fd_handle_t handle, uint8_
 {
     tiny_mutex_lock(&handle->frames.mutex);
     uint32_t time_passed_since_last_sent_i_frame = (uint32_t)(tiny_millis() - handle->peers[peer].last_sent_i_ts);
+    if ( handle->peers[peer].remote_busy && __time_passed_since_last_frame_sent(handle, peer) >= handle->peers[peer].rto )
+    {
+        // Peer is busy: I-frames are not retransmitted, peer is polled by RR command until it answers with RR
+        handle->peers[peer].ka_confirmed = 0;
+        __put_s_frame_to_tx_queue(handle, __peer_to_address_field( handle, peer ) | HDLC_CR_BIT, __rx_ready_frame_type( handle ),
+                                  __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control), true);
+        handle->peers[peer].last_sent_frame_ts = tiny_millis();
+    }
     // If all I-frames are sent and no respond from the remote side
-    if ( __i_queue_control_has_unconfirmed_frames(&handle->peers[peer].i_queue_control) &&
+    else if ( !handle->peers[peer].remote_busy && __i_queue_control_has_unconfirmed_frames(&handle->peers[peer].i_queue_control) &&
          __all_frames_are_sent(&handle->peers[peer].i_queue_control) &&
-         time_passed_since_last_sent_i_frame >= handle->retry_timeout )
+         time_passed_since_last_sent_i_frame >= handle->peers[peer].rto )
     {
         // if sent frame was not confirmed due to noisy line
         if ( handle->peers[peer].retries > 0 )
@@ -599,9 +898,10 @@ static void tiny_fd_connected_check_idle_timeout(tiny_fd_handle_t handle, uint8_
             LOG(TINY_LOG_WRN,
                 "[%p] Timeout, resending unconfirmed frames: last(%" PRIu32 " ms, now(%" PRIu32 " ms), timeout(%" PRIu32
                 " ms))\n",
-                handle, handle->peers[peer].last_sent_i_ts, tiny_millis(), handle->retry_timeout);
+                handle, handle->peers[peer].last_sent_i_ts, tiny_millis(), (uint32_t)handle->peers[peer].rto);
             handle->peers[peer].retries--;
             __resend_all_unconfirmed_frames(handle, peer, 0, __i_queue_control_get_next_frame_to_confirm( &handle->peers[peer].i_queue_control ));
+            __backoff_rto(handle, peer);
         }
         else
         {
@@ -617,16 +917,20 @@ static void tiny_fd_connected_check_idle_timeout(tiny_fd_handle_t handle, uint8_
             __switch_to_disconnected_state(handle, peer);
         }
     }
+    else if ( handle->ack_delay && __time_passed_since_last_frame_sent(handle, peer) >= handle->ack_delay &&
+              handle->peers[peer].sent_nr != __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control) )
+    {
+        // Delayed acknowledgement: nothing was sent back since some I-frames were received
+        __put_s_frame_to_tx_queue(handle, __peer_to_address_field( handle, peer ), __rx_ready_frame_type( handle ),
+                                  __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control), false);
+        handle->peers[peer].last_sent_frame_ts = tiny_millis();
+    }
     else if ( __time_passed_since_last_frame_sent(handle, peer) >= handle->ka_timeout )
     {
         // Nothing to send, all frames are confirmed, just send keep alive
-        tiny_frame_header_t frame = {
-            .address = __peer_to_address_field( handle, peer ),
-            .control = HDLC_S_FRAME_BITS | HDLC_S_FRAME_TYPE_RR | HDLC_P_BIT |
-               (__i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control) << 5),
-        };
         handle->peers[peer].ka_confirmed = 0;
-        __put_u_s_frame_to_tx_queue(handle, TINY_FD_QUEUE_S_FRAME, &frame, 2);
+        __put_s_frame_to_tx_queue(handle, __peer_to_address_field( handle, peer ), __rx_ready_frame_type( handle ),
+                                  __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control), true);
         handle->peers[peer].last_sent_frame_ts = tiny_millis();
     }
     tiny_mutex_unlock(&handle->frames.mutex);
@@ -646,7 +950,7 @@ static void tiny_fd_disconnected_check_idle_timeout(tiny_fd_handle_t handle, uin
             // Try to establish Connection
             tiny_frame_header_t frame = {
                 .address = __peer_to_address_field( handle, peer ) | HDLC_CR_BIT,
-                .control = (handle->mode == TINY_FD_MODE_NRM ? HDLC_U_FRAME_TYPE_SNRM : HDLC_U_FRAME_TYPE_SABM) | HDLC_U_FRAME_BITS,
+                .control = __set_mode_frame_type( handle ) | HDLC_U_FRAME_BITS,
             };
             if ( __put_u_s_frame_to_tx_queue(handle, TINY_FD_QUEUE_U_FRAME, &frame, 2) == NULL )
             {
@@ -679,7 +983,10 @@ int tiny_fd_get_tx_data(tiny_fd_handle_t handle, void *data, int len, uint32_t t
         // Check if send on hdlc level operation is in progress and do some work
         if ( tiny_events_wait(&handle->events, FD_EVENT_TX_SENDING, EVENT_BITS_LEAVE, 0) )
         {
+            // Frames in hdlc TX queue can be purged by other threads, see __purge_tx_queue()
+            tiny_mutex_lock(&handle->frames.mutex);
             generated_data = hdlc_ll_run_tx(handle->_hdlc, ((uint8_t *)data) + result, len - result);
+            tiny_mutex_unlock(&handle->frames.mutex);
         }
         else
         {
@@ -708,8 +1015,10 @@ int tiny_fd_get_tx_data(tiny_fd_handle_t handle, void *data, int len, uint32_t t
                 if ( tiny_events_wait(&handle->events, FD_EVENT_TX_DATA_AVAILABLE, EVENT_BITS_CLEAR, timeout) || handle->mode == TINY_FD_MODE_NRM )
                 {
                     int frame_len = 0;
+                    tiny_mutex_lock(&handle->frames.mutex);
                     uint8_t *frame_data = tiny_fd_get_next_frame_to_send(handle, &frame_len, peer);
-                    if ( frame_data != NULL )
+                    const bool has_frame = frame_data != NULL;
+                    if ( has_frame )
                     {
                         // Force to check for new frame once again
                         tiny_events_set(&handle->events, FD_EVENT_TX_DATA_AVAILABLE);
@@ -718,6 +1027,18 @@ int tiny_fd_get_tx_data(tiny_fd_handle_t handle, void *data, int len, uint32_t t
                         // (FD_EVENT_TX_SENDING is not set). And at this step we do not need hdlc_send() to
                         // send data.
                         hdlc_ll_put_frame(handle->_hdlc, frame_data, frame_len);
+                        // In ABM mode next frames wait in hdlc queue and go to the channel back-to-back.
+                        // NRM station must stop after the frame with P/F bit, so it passes frames one by one
+                        while ( handle->mode == TINY_FD_MODE_ABM &&
+                                handle->_hdlc->tx.queue_count < handle->_hdlc->tx.queue_size &&
+                                (frame_data = tiny_fd_get_next_frame_to_send(handle, &frame_len, peer)) != NULL )
+                        {
+                            hdlc_ll_put_frame(handle->_hdlc, frame_data, frame_len);
+                        }
+                    }
+                    tiny_mutex_unlock(&handle->frames.mutex);
+                    if ( has_frame )
+                    {
                         continue;
                     }
                     else if ( handle->mode == TINY_FD_MODE_ABM || __is_secondary_station( handle ) )
@@ -732,7 +1053,7 @@ int tiny_fd_get_tx_data(tiny_fd_handle_t handle, void *data, int len, uint32_t t
             }
             else if ( __is_primary_station( handle ) )
             {
-                if ( __time_passed_since_last_marker_seen(handle) >= handle->retry_timeout )
+                if ( __time_passed_since_last_marker_seen(handle) >= handle->peers[peer].rto )
                 {
                     // Return marker back to primary station as remote station not responding
                     LOG(TINY_LOG_CRIT, "[%p] RETURN MARKER BACK\n", handle );
@@ -789,17 +1110,24 @@ int tiny_fd_run_tx(tiny_fd_handle_t handle, write_block_cb_t write_func)
 
 ///////////////////////////////////////////////////////////////////////////////
 
-int tiny_fd_send_packet_to(tiny_fd_handle_t handle, uint8_t address, const void *data, int len, uint32_t timeout)
+static uint8_t __user_address_to_peer(tiny_fd_handle_t handle, uint8_t address)
 {
-    int result = TINY_SUCCESS;
-    uint8_t peer;
-    LOG(TINY_LOG_DEB, "[%p] PUT frame\n", handle);
     if ( __is_secondary_station( handle ) && address == TINY_FD_PRIMARY_ADDR )
     {
         // For secondary stations the address is actually from field
         address = handle->addr;
     }
-    peer = __address_field_to_peer( handle, (address << 2) | HDLC_E_BIT );
+    return __address_field_to_peer( handle, (address << 2) | HDLC_E_BIT );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int tiny_fd_send_packet_to(tiny_fd_handle_t handle, uint8_t address, const void *data, int len, uint32_t timeout)
+{
+    int result = TINY_SUCCESS;
+    uint8_t peer;
+    LOG(TINY_LOG_DEB, "[%p] PUT frame\n", handle);
+    peer = __user_address_to_peer( handle, address );
     if ( peer == HDLC_INVALID_PEER_INDEX )
     {
         LOG(TINY_LOG_ERR, "[%p] PUT frame error: Unknown peer\n", handle);
@@ -808,40 +1136,35 @@ int tiny_fd_send_packet_to(tiny_fd_handle_t handle, uint8_t address, const void
     // Check frame size againts mtu
     // MTU doesn't include header and crc fields, only user payload
     uint32_t start_ms = tiny_millis();
-    if ( len > tiny_fd_queue_get_mtu( &handle->frames.i_queue ) )
+    if ( len > tiny_fd_get_mtu( handle ) )
     {
-        LOG(TINY_LOG_ERR, "[%p] PUT frame error: data len %i is greater MTU %i\n", handle, len, handle->frames.i_queue.mtu);
+        LOG(TINY_LOG_ERR, "[%p] PUT frame error: data len %i is greater MTU %i\n", handle, len, tiny_fd_get_mtu( handle ));
         result = TINY_ERR_DATA_TOO_LARGE;
     }
     // Wait until there is room for new frame
     else if ( tiny_events_wait(&handle->peers[peer].events, FD_EVENT_CAN_ACCEPT_I_FRAMES, EVENT_BITS_CLEAR, timeout) )
     {
         uint32_t delta_ms = (uint32_t)(tiny_millis() - start_ms);
-        if ( tiny_events_wait(&handle->events, FD_EVENT_QUEUE_HAS_FREE_SLOTS, EVENT_BITS_CLEAR,
+        if ( tiny_events_wait(&handle->events, __i_queue_free_slots_event_for(handle, len), EVENT_BITS_CLEAR,
                                timeout > delta_ms ? (timeout - delta_ms) : 0) )
         {
             tiny_mutex_lock(&handle->frames.mutex);
             // Check if space is actually available
             if ( __put_i_frame_to_tx_queue(handle, peer, data, len) )
             {
-                if ( tiny_fd_queue_has_free_slots( &handle->frames.i_queue ) )
-                {
-                    __i_queue_control_log_statistics(&handle->peers[peer].i_queue_control, 0);
-                    tiny_events_set(&handle->events, FD_EVENT_QUEUE_HAS_FREE_SLOTS);
-                }
-                else
-                {
-                    __i_queue_control_log_statistics(&handle->peers[peer].i_queue_control, 1);
-                }
+                __i_queue_control_log_statistics(&handle->peers[peer].i_queue_control,
+                                                 !tiny_fd_queue_has_free_slots( &handle->frames.i_queue ));
                 result = TINY_SUCCESS;
             }
             else
             {
                 result = TINY_ERR_TIMEOUT;
-                // !!!! If this log appears, then in the code of the protocol something is definitely wrong !!!!
+                // If there are no small slots, and this log appears, then in the code of the protocol something is wrong.
+                // With small slots the concurrent sender of a small frame can take the last full-size slot.
                 LOG(TINY_LOG_ERR, "[%p] Wrong flag FD_EVENT_QUEUE_HAS_FREE_SLOTS\n", handle);
             }
-            if ( !__i_queue_control_tx_full( &handle->peers[peer].i_queue_control ) )
+            __update_i_queue_free_slots_events( handle );
+            if ( __peer_can_accept_i_frames( handle, peer ) )
             {
                 tiny_events_set(&handle->peers[peer].events, FD_EVENT_CAN_ACCEPT_I_FRAMES);
             }
@@ -873,13 +1196,138 @@ int tiny_fd_send_packet(tiny_fd_handle_t handle, const void *data, int len, uint
 
 ///////////////////////////////////////////////////////////////////////////////
 
+uint8_t *tiny_fd_tx_reserve(tiny_fd_handle_t handle, uint8_t address, int max_len, uint32_t timeout)
+{
+    uint8_t *data = NULL;
+    if ( handle == NULL || max_len <= 0 )
+    {
+        return NULL;
+    }
+    uint8_t peer = __user_address_to_peer( handle, address );
+    if ( peer == HDLC_INVALID_PEER_INDEX )
+    {
+        LOG(TINY_LOG_ERR, "[%p] RESERVE frame error: Unknown peer\n", handle);
+        return NULL;
+    }
+    if ( max_len > tiny_fd_get_mtu( handle ) )
+    {
+        LOG(TINY_LOG_ERR, "[%p] RESERVE frame error: data len %i is greater MTU %i\n", handle, max_len, tiny_fd_get_mtu( handle ));
+        return NULL;
+    }
+    uint32_t start_ms = tiny_millis();
+    // FD_EVENT_CAN_ACCEPT_I_FRAMES stays cleared until the reserved slot is committed or aborted
+    if ( tiny_events_wait(&handle->peers[peer].events, FD_EVENT_CAN_ACCEPT_I_FRAMES, EVENT_BITS_CLEAR, timeout) )
+    {
+        uint32_t delta_ms = (uint32_t)(tiny_millis() - start_ms);
+        tiny_fd_frame_info_t *slot = NULL;
+        if ( tiny_events_wait(&handle->events, __i_queue_free_slots_event_for(handle, max_len), EVENT_BITS_CLEAR,
+                               timeout > delta_ms ? (timeout - delta_ms) : 0) )
+        {
+            tiny_mutex_lock(&handle->frames.mutex);
+            slot = tiny_fd_queue_allocate( &handle->frames.i_queue, TINY_FD_QUEUE_RESERVED, NULL, max_len + handle->ext_control );
+            if ( slot != NULL )
+            {
+                handle->peers[peer].reserved_slot = (uint8_t)tiny_fd_queue_get_index( &handle->frames.i_queue, slot );
+                data = &slot->payload[handle->ext_control];
+            }
+            __update_i_queue_free_slots_events( handle );
+            tiny_mutex_unlock(&handle->frames.mutex);
+        }
+        if ( slot == NULL )
+        {
+            tiny_events_set(&handle->peers[peer].events, FD_EVENT_CAN_ACCEPT_I_FRAMES);
+            LOG(TINY_LOG_WRN, "[%p] RESERVE frame timeout\n", handle);
+        }
+    }
+    return data;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static uint8_t __reserved_slot_to_peer(tiny_fd_handle_t handle, const uint8_t *data)
+{
+    for ( uint8_t peer = 0; peer < handle->peers_count; peer++ )
+    {
+        uint8_t index = handle->peers[peer].reserved_slot;
+        if ( index != I_QUEUE_CONTROL_NO_SLOT &&
+             &tiny_fd_queue_get_by_index( &handle->frames.i_queue, index )->payload[handle->ext_control] == data )
+        {
+            return peer;
+        }
+    }
+    return HDLC_INVALID_PEER_INDEX;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static int __release_reserved_slot(tiny_fd_handle_t handle, const uint8_t *data, int len, bool commit)
+{
+    int result = TINY_SUCCESS;
+    if ( handle == NULL || data == NULL )
+    {
+        return TINY_ERR_INVALID_DATA;
+    }
+    tiny_mutex_lock(&handle->frames.mutex);
+    uint8_t peer = __reserved_slot_to_peer( handle, data );
+    if ( peer == HDLC_INVALID_PEER_INDEX )
+    {
+        tiny_mutex_unlock(&handle->frames.mutex);
+        return TINY_ERR_INVALID_DATA;
+    }
+    tiny_fd_frame_info_t *slot = tiny_fd_queue_get_by_index( &handle->frames.i_queue, handle->peers[peer].reserved_slot );
+    if ( commit && (len < 0 || len > slot->len - handle->ext_control) )
+    {
+        // Keep reservation, the application can commit less data or abort
+        tiny_mutex_unlock(&handle->frames.mutex);
+        return TINY_ERR_DATA_TOO_LARGE;
+    }
+    handle->peers[peer].reserved_slot = I_QUEUE_CONTROL_NO_SLOT;
+    if ( commit && handle->peers[peer].state == TINY_FD_STATE_CONNECTED &&
+         !__i_queue_control_tx_full( &handle->peers[peer].i_queue_control ) )
+    {
+        slot->len = len + handle->ext_control;
+        __enqueue_i_frame_slot( handle, peer, slot );
+        __i_queue_control_log_statistics(&handle->peers[peer].i_queue_control,
+                                         !tiny_fd_queue_has_free_slots( &handle->frames.i_queue ));
+    }
+    else
+    {
+        // Connection was reset while the application was writing to the slot
+        result = commit ? TINY_ERR_FAILED : TINY_SUCCESS;
+        tiny_fd_queue_free( &handle->frames.i_queue, slot );
+    }
+    __update_i_queue_free_slots_events( handle );
+    if ( handle->peers[peer].state == TINY_FD_STATE_CONNECTED && __peer_can_accept_i_frames( handle, peer ) )
+    {
+        tiny_events_set(&handle->peers[peer].events, FD_EVENT_CAN_ACCEPT_I_FRAMES);
+    }
+    tiny_mutex_unlock(&handle->frames.mutex);
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int tiny_fd_tx_commit(tiny_fd_handle_t handle, uint8_t *data, int len)
+{
+    return __release_reserved_slot( handle, data, len, true );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int tiny_fd_tx_abort(tiny_fd_handle_t handle, uint8_t *data)
+{
+    return __release_reserved_slot( handle, data, 0, false );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 int tiny_fd_send_ui_packet_to(tiny_fd_handle_t handle, uint8_t address, const void *data, int len)
 {
     if ( handle == NULL || (data == NULL && len > 0) )
     {
         return TINY_ERR_INVALID_DATA;
     }
-    if ( len > tiny_fd_queue_get_mtu( &handle->frames.s_queue ) )
+    if ( len > tiny_fd_queue_get_mtu( __get_ui_queue( handle ) ) )
     {
         return TINY_ERR_DATA_TOO_LARGE;
     }
@@ -895,7 +1343,7 @@ int tiny_fd_send_ui_packet_to(tiny_fd_handle_t handle, uint8_t address, const vo
     }
 
     tiny_mutex_lock(&handle->frames.mutex);
-    tiny_fd_frame_info_t *slot = tiny_fd_queue_allocate( &handle->frames.s_queue, TINY_FD_QUEUE_U_FRAME, data, len );
+    tiny_fd_frame_info_t *slot = tiny_fd_queue_allocate( __get_ui_queue( handle ), TINY_FD_QUEUE_UI_FRAME, data, len );
     if ( slot == NULL )
     {
         tiny_mutex_unlock(&handle->frames.mutex);
@@ -934,15 +1382,14 @@ int tiny_fd_buffer_size_by_mtu_ex(uint8_t peers_count, int mtu, int tx_window, h
     }
     // Aligned size to keep protocol related state machine information
     int header_size = sizeof(tiny_fd_data_t) + TINY_ALIGN_STRUCT_VALUE - 1 +
-                      peers_count * sizeof(tiny_fd_peer_info_t);
+                      __slots_maps_size(peers_count, tx_window) + peers_count * sizeof(tiny_fd_peer_info_t);
     // Buffer size to hold HDLC low level protocol RX data
     int hdlc_level_rx_size = hdlc_ll_get_buf_size_ex(mtu + sizeof(tiny_frame_header_t), crc_type, rx_window);
     // minimum size of i-frame including header and payload
-    int i_frame_tx_size = (sizeof(tiny_fd_frame_info_t *) + sizeof(tiny_fd_frame_info_t) + mtu -
+    int i_frame_tx_size = (sizeof(tiny_fd_frame_info_t) + mtu -
             sizeof(((tiny_fd_frame_info_t *)0)->payload));
     // minimum size of s-frame/u-frame including header and 2-bytes payload
-    // this size includes internal library overhead, introduced by the pointer to the frame info
-    int u_s_frame_tx_size = (sizeof(tiny_fd_frame_info_t *) + sizeof(tiny_fd_frame_info_t));
+    int u_s_frame_tx_size = sizeof(tiny_fd_frame_info_t);
     return header_size +
            hdlc_level_rx_size +
            // TX side
@@ -952,6 +1399,34 @@ int tiny_fd_buffer_size_by_mtu_ex(uint8_t peers_count, int mtu, int tx_window, h
 
 ///////////////////////////////////////////////////////////////////////////////
 
+int tiny_fd_buffer_size_by_mtu_slab(uint8_t peers_count, int mtu, int tx_window, hdlc_crc_t crc_type,
+                                    int rx_window, int small_frames, int small_mtu)
+{
+    // Small slots differ from full-size slots by payload size only
+    return tiny_fd_buffer_size_by_mtu_ex(peers_count, mtu, tx_window, crc_type, rx_window) -
+           small_frames * (mtu - small_mtu);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int tiny_fd_buffer_size_by_init(const tiny_fd_init_t *init)
+{
+    const int ui_mtu = init->ui_mtu ? init->ui_mtu : init->mtu;
+    // UI queue slots have the same layout as tx slots for I-frames
+    int ui_frame_size = (sizeof(tiny_fd_frame_info_t) + ui_mtu - sizeof(((tiny_fd_frame_info_t *)0)->payload));
+    // In extended mode each I-frame carries one more byte of control field
+    const int ext_control = init->extended_mode ? 1 : 0;
+    return tiny_fd_buffer_size_by_mtu_slab(init->peers_count, init->mtu + ext_control, init->window_frames, init->crc_type,
+                                           __rx_window(init), init->small_frames, init->small_frames ? init->small_mtu + ext_control : 0) +
+           (init->ui_frames ? (int)sizeof(tiny_fd_queue_t) + ui_frame_size * init->ui_frames : 0) +
+           (int)HDLC_TX_QUEUE_BUF_SIZE(init->tx_queue_size) +
+           __rx_reorder_count(init) * (int)sizeof(tiny_fd_rx_frame_t) +
+           __rx_messages_size(init) +
+           __tail_pads_size(init);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void tiny_fd_set_ka_timeout(tiny_fd_handle_t handle, uint32_t keep_alive)
 {
     handle->ka_timeout = keep_alive;
@@ -961,7 +1436,7 @@ void tiny_fd_set_ka_timeout(tiny_fd_handle_t handle, uint32_t keep_alive)
 
 int tiny_fd_get_mtu(tiny_fd_handle_t handle)
 {
-    return tiny_fd_queue_get_mtu( &handle->frames.i_queue );
+    return tiny_fd_queue_get_mtu( &handle->frames.i_queue ) - handle->ext_control;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -972,8 +1447,7 @@ int tiny_fd_send_to(tiny_fd_handle_t handle, uint8_t address, const void *data,
     int left_bytes = len;
     while ( left_bytes > 0 )
     {
-        int size = left_bytes < tiny_fd_queue_get_mtu( &handle->frames.i_queue ) ?
-                        left_bytes : tiny_fd_queue_get_mtu( &handle->frames.i_queue );
+        int size = left_bytes < tiny_fd_get_mtu( handle ) ? left_bytes : tiny_fd_get_mtu( handle );
         int result = tiny_fd_send_packet_to(handle, address, ptr, size, timeout);
         if ( result != TINY_SUCCESS )
         {
@@ -994,6 +1468,57 @@ int tiny_fd_send(tiny_fd_handle_t handle, const void *data, int len, uint32_t ti
 
 ///////////////////////////////////////////////////////////////////////////////
 
+int tiny_fd_send_message_to(tiny_fd_handle_t handle, uint8_t address, const void *data, int len, uint32_t timeout)
+{
+    if ( handle == NULL || (data == NULL && len > 0) || len < 0 )
+    {
+        return TINY_ERR_INVALID_DATA;
+    }
+    if ( __user_address_to_peer( handle, address ) == HDLC_INVALID_PEER_INDEX )
+    {
+        return TINY_ERR_UNKNOWN_PEER;
+    }
+    const int fragment_size = tiny_fd_get_mtu( handle ) - FD_MESSAGE_HEADER_SIZE;
+    if ( fragment_size <= 0 )
+    {
+        return TINY_ERR_DATA_TOO_LARGE;
+    }
+    const uint8_t *ptr = (const uint8_t *)data;
+    int left_bytes = len;
+    uint8_t header = FD_MESSAGE_FIRST_FRAGMENT;
+    do
+    {
+        int size = left_bytes < fragment_size ? left_bytes : fragment_size;
+        // Fragment is serialized directly to the I-frame slot, and doesn't wait for acknowledgement of previous ones
+        uint8_t *buf = tiny_fd_tx_reserve( handle, address, size + FD_MESSAGE_HEADER_SIZE, timeout );
+        if ( buf == NULL )
+        {
+            LOG(TINY_LOG_ERR, "[%p] Message is interrupted, %i bytes are not sent\n", handle, left_bytes);
+            return TINY_ERR_TIMEOUT;
+        }
+        left_bytes -= size;
+        buf[0] = header | (left_bytes ? FD_MESSAGE_MORE_FRAGMENTS : 0);
+        memcpy( &buf[FD_MESSAGE_HEADER_SIZE], ptr, size );
+        int result = tiny_fd_tx_commit( handle, buf, size + FD_MESSAGE_HEADER_SIZE );
+        if ( result != TINY_SUCCESS )
+        {
+            return result;
+        }
+        ptr += size;
+        header = 0;
+    } while ( left_bytes > 0 );
+    return TINY_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int tiny_fd_send_message(tiny_fd_handle_t handle, const void *data, int len, uint32_t timeout)
+{
+    return tiny_fd_send_message_to(handle, TINY_FD_PRIMARY_ADDR, data, len, timeout);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 int tiny_fd_get_status(tiny_fd_handle_t handle)
 {
     uint8_t peer = 0; // TODO: Request for specific peer
@@ -48,7 +48,9 @@ extern "C"
 #endif
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "proto/crc/tiny_crc.h"
+#include "proto/hdlc/low_level/hdlc.h"
 #include "hal/tiny_types.h"
 
     /**
@@ -141,6 +143,8 @@ extern "C"
         TINY_FD_FRAME_SUBTYPE_RSET = 0x8C, ///< U-frame subtype RSET
         TINY_FD_FRAME_SUBTYPE_SABM = 0x2C, ///< U-frame subtype SABM
         TINY_FD_FRAME_SUBTYPE_SNRM = 0x80, ///< U-frame subtype SNRM
+        TINY_FD_FRAME_SUBTYPE_SABME = 0x6C, ///< U-frame subtype SABME (extended mode)
+        TINY_FD_FRAME_SUBTYPE_SNRME = 0xCC, ///< U-frame subtype SNRME (extended mode)
         TINY_FD_FRAME_SUBTYPE_DISC = 0x40, ///< U-frame subtype DISC
         TINY_FD_FRAME_SUBTYPE_UI = 0x00, ///< U-frame subtype UI (Unnumbered Information)
     } tiny_fd_frame_subtype_t;
@@ -223,6 +227,21 @@ extern "C"
          */
         uint16_t retry_timeout;
 
+        /**
+         * Lower bound of adaptive retransmission timeout in milliseconds. The field has meaning
+         * only if rto_max is not zero.
+         */
+        uint16_t rto_min;
+
+        /**
+         * Upper bound of adaptive retransmission timeout in milliseconds. If this parameter is not zero,
+         * round trip time is measured for each peer, and I-frames are retransmitted after the timeout,
+         * calculated from smoothed round trip time and its variation (RFC 6298). retry_timeout is used
+         * until the first measurement, and the timeout is doubled after each retransmission.
+         * If this parameter is zero, retry_timeout is always used.
+         */
+        uint16_t rto_max;
+
         /**
          * number retries to perform before timeout takes place
          */
@@ -237,7 +256,7 @@ extern "C"
 
         /**
          * Number of frames in window, which confirmation may be deferred for. Must be at least 1. Maximum allowable
-         * value is 7. Extended HDLC format (with 127 window size) is not yet supported.
+         * value is 7, or 127 if extended_mode is set.
          * Smaller values reduce channel throughput, while higher values require more RAM.
          * It is not mandatory to have the same window_frames value on both endpoints.
          */
@@ -292,6 +311,146 @@ extern "C"
          */
         on_frame_read_cb_t on_read_ui_cb;
 
+        /**
+         * Framing to use on the line: HDLC_FRAMING_HDLC (default), HDLC_FRAMING_COBS or
+         * HDLC_FRAMING_LENGTH. Both endpoints must use the same framing.
+         */
+        hdlc_framing_t framing;
+
+        /**
+         * Number of frames, which can wait in HDLC TX queue behind the frame being sent (ABM mode only).
+         * Single tiny_fd_get_tx_data() call then puts several frames to the channel back-to-back.
+         * If this parameter is zero, tiny_fd_get_tx_data() returns data of single frame at a time.
+         * Use tiny_fd_buffer_size_by_init() to calculate buffer_size.
+         */
+        uint8_t tx_queue_size;
+
+        /**
+         * If true, frames sent back-to-back share single 0x7E flag (HDLC_FRAMING_HDLC only).
+         * Both endpoints must use the same option.
+         */
+        bool shared_flag;
+
+        /**
+         * Number of I-frame TX slots out of window_frames, which can hold only up to small_mtu bytes of payload.
+         * If this parameter is zero, all TX slots hold mtu bytes. Small slots allow to keep wide window
+         * for short packets with less RAM, while long packets still use remaining full-size slots.
+         * Must be less than window_frames. Use tiny_fd_buffer_size_by_mtu_slab() to calculate buffer_size.
+         */
+        uint8_t small_frames;
+
+        /**
+         * Maximum payload size of small I-frame TX slots in bytes. Must be less than mtu.
+         * The field has meaning only if small_frames is not zero.
+         */
+        int small_mtu;
+
+        /**
+         * Number of slots in dedicated UI-frame queue. If this parameter is zero, UI frames share
+         * the small queue of service S- and U- frames, and can take the room needed for acknowledgements.
+         * UI frames are always sent after service frames.
+         */
+        uint8_t ui_frames;
+
+        /**
+         * Maximum payload size of UI frames in bytes, if ui_frames is not zero. If this parameter is zero,
+         * mtu is used.
+         */
+        int ui_mtu;
+
+        /**
+         * Maximum number of I-frame TX slots, which single peer can hold in NRM mode. Frames
+         * queued for a slow or offline secondary cannot take the whole tx window, so the other peers
+         * still can queue their frames. If this parameter is zero, there is no per-peer limit.
+         */
+        uint8_t peer_tx_quota;
+
+        /**
+         * Deficit round robin quantum in payload bytes for NRM primary station. Each time the marker
+         * is given to the peer, peer's deficit is increased by quantum, and primary sends I-frames to that
+         * peer only while their payload fits the deficit. If this parameter is zero, primary sends all queued
+         * I-frames to the peer before passing the marker to the next peer.
+         */
+        uint16_t peer_quantum;
+
+        /**
+         * Use extended (modulo 128) sequence numbers. The link is set up by SABME/SNRME instead of SABM/SNRM,
+         * I- and S-frames have 2-byte control field, and window_frames can be up to 127. This keeps the link
+         * busy on channels with high bandwidth-delay product. Both endpoints must use the same mode.
+         * Use tiny_fd_buffer_size_by_init() to calculate buffer_size for extended mode.
+         */
+        bool extended_mode;
+
+        /**
+         * Buffer out of order I-frames and request only missing frames by SREJ (selective repeat).
+         * Without this option the station drops out of order frames and sends REJ (go-back-N).
+         * Out of order frames are kept in HDLC RX slots, so the buffer must be large enough for several
+         * RX frames (tiny_fd_buffer_size_by_init() reserves them). Up to 30 out of order frames are
+         * buffered, next ones are dropped. window_frames must not exceed half of the sequence space:
+         * 4, or 64 if extended_mode is set. Remote side must use the same limit for its window.
+         */
+        bool selective_repeat;
+
+        /**
+         * Number of received frames, which the application can keep at once with tiny_fd_rx_hold().
+         * tiny_fd_buffer_size_by_init() reserves extra RX slots for them. Zero by default.
+         * Only 32 RX slots can be held, including out of order frames of selective_repeat,
+         * so tiny_fd_init() rejects larger values.
+         */
+        uint8_t rx_hold_frames;
+
+        /**
+         * Low-water mark of free RX slots. When tiny_fd_rx_hold() leaves this number of slots or less,
+         * which still can be held, RNR is sent to the peers, and RR is sent after tiny_fd_rx_release()
+         * when there are more free slots again. Zero by default: RNR is sent when the last slot is taken.
+         */
+        uint8_t rx_low_water;
+
+        /**
+         * Number of in-sequence I-frames, acknowledged by single RR frame, if ack_delay is not zero.
+         * RR is sent after ack_frames I-frames, or when half of window_frames I-frames are not acknowledged,
+         * whichever comes first. If this parameter is zero, only the half window limit is used.
+         * N(R) of outgoing I-frames still acknowledges received frames without delay.
+         */
+        uint8_t ack_frames;
+
+        /**
+         * Maximum time in milliseconds to delay RR frame for acknowledging received I-frames.
+         * If this parameter is zero, RR is sent for each in-sequence I-frame, if there is nothing else to send.
+         * The value must be less than retry_timeout of the remote side to avoid retransmissions.
+         */
+        uint16_t ack_delay;
+
+        /**
+         * Enables P/F checkpointing in ABM mode. The station sets P bit on the last I-frame it can send
+         * (window is full or no more frames are queued). The peer answers immediately with F bit set,
+         * and lost frames are retransmitted from reported N(R) without waiting for retry_timeout.
+         * The remote side answers checkpoints regardless of this option.
+         */
+        bool checkpointing;
+
+        /**
+         * Callback to process messages, sent by the remote side with tiny_fd_send_message_to().
+         * If this callback is set, each received I-frame is treated as message fragment: it starts with
+         * 1-byte header (bit 0 - first fragment, bit 1 - more fragments follow), and fragments are collected
+         * in order to reassembly buffer. The callback is called once for complete message, and on_read_cb is
+         * not called for I-frames. Both sides must use messages, if this callback is set.
+         */
+        on_frame_read_cb_t on_message_cb;
+
+        /**
+         * Buffer for messages reassembly, message_size bytes per peer. If the field is NULL,
+         * reassembly buffers are allocated from the protocol buffer (refer to tiny_fd_buffer_size_by_init()).
+         * The field has meaning only if on_message_cb is set.
+         */
+        uint8_t *message_buffer;
+
+        /**
+         * Maximum size of received message in bytes. Longer messages are dropped.
+         * Must be set, if on_message_cb is set.
+         */
+        int message_size;
+
     } tiny_fd_init_t;
 
     /**
@@ -399,6 +558,35 @@ extern "C"
      */
     extern int tiny_fd_run_rx(tiny_fd_handle_t handle, read_block_cb_t read_func);
 
+    /**
+     * @brief Keeps received I-frame payload valid after on_read_cb returns.
+     *
+     * Call this function from on_read_cb to get the received payload on loan, and process it
+     * later, for example, in other thread. RX buffer slot stays pinned until tiny_fd_rx_release() is called.
+     * Up to rx_hold_frames frames can be held (see tiny_fd_init_t::rx_hold_frames). When free slots drop
+     * to rx_low_water, the protocol sends RNR (receiver not ready) to the peers, and RR after tiny_fd_rx_release().
+     * While all of them are on loan, the protocol doesn't accept new I-frames and doesn't acknowledge them,
+     * so the remote side retransmits them later.
+     *
+     * @param handle handle of full-duplex protocol
+     * @param buf pointer to payload, passed to on_read_cb
+     * @return TINY_SUCCESS if payload is held
+     *         TINY_ERR_BUSY if all RX slots are already on loan, payload must be processed inside callback.
+     *         TINY_ERR_INVALID_DATA if buf is not received payload.
+     */
+    extern int tiny_fd_rx_hold(tiny_fd_handle_t handle, const uint8_t *buf);
+
+    /**
+     * @brief Returns payload, held by tiny_fd_rx_hold(), to the protocol.
+     *
+     * Can be called from any thread. If RNR was sent to the peers, RR is sent to resume transmission.
+     *
+     * @param handle handle of full-duplex protocol
+     * @param buf pointer to held payload
+     * @return TINY_SUCCESS or TINY_ERR_INVALID_DATA if buf is not held.
+     */
+    extern int tiny_fd_rx_release(tiny_fd_handle_t handle, const uint8_t *buf);
+
     /**
      * @brief Sends userdata over full-duplex protocol.
      *
@@ -450,6 +638,30 @@ extern "C"
      */
     extern int tiny_fd_buffer_size_by_mtu_ex(uint8_t peers_count, int mtu, int tx_window, hdlc_crc_t crc_type, int rx_window);
 
+    /**
+     * Returns minimum required buffer size for specified parameters, when some I-frame TX slots
+     * are small (see tiny_fd_init_t::small_frames).
+     *
+     * @param peers_count maximum number of peers supported by the primary. Use 0 or 1 for secondary devices
+     * @param mtu size of desired user payload in bytes.
+     * @param tx_window maximum tx queue size of I-frames.
+     * @param crc_type crc type to be used with FD protocol
+     * @param rx_window number of RX ring buffer in frames
+     * @param small_frames number of tx slots out of tx_window, which hold only small_mtu bytes
+     * @param small_mtu size of user payload in bytes for small tx slots.
+     */
+    extern int tiny_fd_buffer_size_by_mtu_slab(uint8_t peers_count, int mtu, int tx_window, hdlc_crc_t crc_type,
+                                               int rx_window, int small_frames, int small_mtu);
+
+    /**
+     * Returns minimum required buffer size for the configuration in init structure.
+     * The function takes into account peers_count, mtu, window_frames, crc_type, small tx slots
+     * and UI-frame queue. mtu field must be set.
+     *
+     * @param init pointer to initialization structure
+     */
+    extern int tiny_fd_buffer_size_by_init(const tiny_fd_init_t *init);
+
     /**
      * @brief returns max packet size in bytes.
      *
@@ -481,6 +693,38 @@ extern "C"
      */
     extern int tiny_fd_send_to(tiny_fd_handle_t handle, uint8_t address, const void *buf, int len, uint32_t timeout);
 
+    /**
+     * @brief Sends message of any length over full-duplex protocol.
+     *
+     * Splits the message to I-frames, each one carries 1-byte fragment header and up to mtu - 1 bytes
+     * of the message. Fragments are placed to outgoing queue without waiting for acknowledgements,
+     * so the message is transferred using full window. The remote side must have on_message_cb set:
+     * it gets the message with single callback call after the last fragment is received.
+     * If timeout happens in the middle of message, the remote side drops incomplete message
+     * when the first fragment of the next message arrives.
+     *
+     * @param handle   tiny_fd_handle_t handle
+     * @param address  address of remote peer. For primary device, please use TINY_FD_PRIMARY_ADDR
+     * @param buf      message to send
+     * @param len      length of message
+     * @param timeout  timeout in milliseconds, will be used for each fragment sending
+     *
+     * @return TINY_SUCCESS if all fragments are placed to outgoing queue, or error code
+     */
+    extern int tiny_fd_send_message_to(tiny_fd_handle_t handle, uint8_t address, const void *buf, int len, uint32_t timeout);
+
+    /**
+     * Sends message to primary station. For details, please, refer to tiny_fd_send_message_to().
+     *
+     * @param handle   tiny_fd_handle_t handle
+     * @param buf      message to send
+     * @param len      length of message
+     * @param timeout  timeout in milliseconds, will be used for each fragment sending
+     *
+     * @return TINY_SUCCESS if all fragments are placed to outgoing queue, or error code
+     */
+    extern int tiny_fd_send_message(tiny_fd_handle_t handle, const void *buf, int len, uint32_t timeout);
+
     /**
      * Sets keep alive timeout in milliseconds. This timeout is used to send special RR
      * frames, when no user data queued for sending.
@@ -532,6 +776,48 @@ extern "C"
      */
     extern int tiny_fd_send_packet(tiny_fd_handle_t handle, const void *buf, int len, uint32_t timeout);
 
+    /**
+     * @brief Reserves I-frame slot in outgoing queue for zero-copy sending.
+     *
+     * Returns pointer to payload area of free I-frame slot, so the application can serialize
+     * data directly to the retransmission buffer of the protocol. The reserved data must be passed to
+     * tiny_fd_tx_commit() or tiny_fd_tx_abort(). Until that, other frames to the same peer cannot be
+     * put to the queue.
+     *
+     * @param handle   tiny_fd_handle_t handle
+     * @param address  address of remote peer. For primary device, please use TINY_FD_PRIMARY_ADDR
+     * @param max_len  maximum length of data to write, must not exceed mtu
+     * @param timeout  timeout in milliseconds to wait until there is room in outgoing queue
+     *
+     * @return pointer to the buffer of max_len bytes, or NULL in case of timeout or error
+     */
+    extern uint8_t *tiny_fd_tx_reserve(tiny_fd_handle_t handle, uint8_t address, int max_len, uint32_t timeout);
+
+    /**
+     * @brief Puts data, written to reserved slot, to outgoing queue.
+     *
+     * @param handle   tiny_fd_handle_t handle
+     * @param buf      pointer returned by tiny_fd_tx_reserve()
+     * @param len      length of written data, must not exceed max_len of reservation
+     *
+     * @return Success result or error code:
+     *         * TINY_SUCCESS          if user data are put to internal queue.
+     *         * TINY_ERR_FAILED       if connection was reset after reservation. Reserved slot is released.
+     *         * TINY_ERR_DATA_TOO_LARGE if len exceeds reserved size. Reservation is kept.
+     *         * TINY_ERR_INVALID_DATA if buf is not a reserved slot.
+     */
+    extern int tiny_fd_tx_commit(tiny_fd_handle_t handle, uint8_t *buf, int len);
+
+    /**
+     * @brief Releases reserved slot without sending.
+     *
+     * @param handle   tiny_fd_handle_t handle
+     * @param buf      pointer returned by tiny_fd_tx_reserve()
+     *
+     * @return TINY_SUCCESS or TINY_ERR_INVALID_DATA if buf is not a reserved slot.
+     */
+    extern int tiny_fd_tx_abort(tiny_fd_handle_t handle, uint8_t *buf);
+
     /**
      * @brief Sends UI (Unnumbered Information) frame over full-duplex protocol.
      *
@@ -546,7 +832,7 @@ extern "C"
      *
      * @return TINY_SUCCESS if the UI frame was queued for sending.
      *         TINY_ERR_FAILED if no room in internal queue.
-     *         TINY_ERR_DATA_TOO_LARGE if data exceeds MTU.
+     *         TINY_ERR_DATA_TOO_LARGE if data exceeds UI queue mtu (see tiny_fd_init_t::ui_mtu).
      *         TINY_ERR_INVALID_DATA if parameters are invalid.
      */
     extern int tiny_fd_send_ui_packet_to(tiny_fd_handle_t handle, uint8_t address, const void *buf, int len);
@@ -65,7 +65,7 @@ enum
 
     /**
      * FD_EVENT_QUEUE_HAS_FREE_SLOTS indicates that there are free slots in the TX queue.
-     * This event is set when there is at least one free slot in the TX queue.
+     * This event is set when there is at least one free slot in the TX queue, which can hold mtu bytes.
      * It is used to notify higher layers that they can send more data.
      */
     FD_EVENT_QUEUE_HAS_FREE_SLOTS = 0x04,  // Global event
@@ -80,8 +80,33 @@ enum
      * 
      */
     FD_EVENT_HAS_MARKER          = 0x10,   // Global event
+
+    /**
+     * FD_EVENT_QUEUE_HAS_FREE_SMALL_SLOTS indicates that a frame up to small_mtu bytes can be put
+     * to the TX queue. It is used only if the TX queue has small slots.
+     */
+    FD_EVENT_QUEUE_HAS_FREE_SMALL_SLOTS = 0x20,  // Global event
+};
+
+enum
+{
+    FD_RTT_IDLE = 0,    // No I-frame is being timed
+    FD_RTT_TIMING = 1,  // Round trip time of the last sent I-frame is being measured
+    FD_RTT_HOLDOFF = 2, // Frames were retransmitted, no measurement until all of them are confirmed (Karn's algorithm)
+    FD_RTT_STATE_MASK = 0x03,
+    FD_RTT_SAMPLED = 0x80, // Flag: round trip time was measured at least once, so srtt and rttvar are valid
 };
 
+// Marks, that no I-frame with P bit is waiting for F answer
+#define FD_NO_CHECKPOINT 0xFF
+// Marks, that F answer is still expected for I-frames, which were rewound by REJ, so it must be ignored
+#define FD_STALE_CHECKPOINT 0xFE
+
+// Each I-frame, carrying a part of message, starts with fragment header byte
+#define FD_MESSAGE_HEADER_SIZE 1
+#define FD_MESSAGE_FIRST_FRAGMENT 0x01
+#define FD_MESSAGE_MORE_FRAGMENTS 0x02
+
 #define HDLC_I_FRAME_BITS 0x00
 #define HDLC_I_FRAME_MASK 0x01
 
@@ -102,6 +127,8 @@ enum
 #define HDLC_U_FRAME_TYPE_RSET 0x8C
 #define HDLC_U_FRAME_TYPE_SABM 0x2C
 #define HDLC_U_FRAME_TYPE_SNRM 0x80
+#define HDLC_U_FRAME_TYPE_SABME 0x6C
+#define HDLC_U_FRAME_TYPE_SNRME 0xCC
 #define HDLC_U_FRAME_TYPE_DISC 0x40
 #define HDLC_U_FRAME_TYPE_UI   0x00
 #define HDLC_U_FRAME_TYPE_MASK 0xEC
@@ -109,6 +136,13 @@ enum
 #define HDLC_P_BIT 0x10
 #define HDLC_F_BIT 0x10
 
+// In extended (modulo 128) mode I- and S-frames have 2-byte control field.
+// The first byte holds frame type and N(S), the second byte holds N(R) and P/F bit.
+#define HDLC_EXT_PF_BIT 0x01
+
+#define HDLC_SEQ_MASK 0x07
+#define HDLC_EXT_SEQ_MASK 0x7F
+
 // C/R bit is command / response bit 
 // When this bit is set, it means that the frame is a command frame
 // When this bit is clear, it means that the frame is a response frame
@@ -119,5 +153,3 @@ enum
 #define HDLC_E_BIT 0x01
 #define HDLC_PRIMARY_ADDR (TINY_FD_PRIMARY_ADDR << 2)
 #define HDLC_INVALID_PEER_INDEX 0xFF
-
-static const uint8_t seq_bits_mask = 0x07;
\ No newline at end of file
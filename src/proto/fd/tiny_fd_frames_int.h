@@ -44,7 +44,10 @@ extern "C"
         TINY_FD_QUEUE_FREE = 0x01,
         TINY_FD_QUEUE_U_FRAME = 0x02,
         TINY_FD_QUEUE_S_FRAME = 0x04,
-        TINY_FD_QUEUE_I_FRAME = 0x08
+        TINY_FD_QUEUE_I_FRAME = 0x08,
+        TINY_FD_QUEUE_UI_FRAME = 0x10,
+        TINY_FD_QUEUE_RESERVED = 0x20, ///< I-frame slot, reserved by the application for zero-copy write
+        TINY_FD_QUEUE_SENDING = 0x40,  ///< Service or UI frame, passed to hdlc level, until on_frame_send
     } tiny_fd_queue_type_t;
 
     typedef struct
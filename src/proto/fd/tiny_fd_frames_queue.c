@@ -30,6 +30,7 @@
 #include "hal/tiny_debug.h"
 
 #include <string.h>
+#include <stddef.h>
 
 #ifndef TINY_FD_DEBUG
 #define TINY_FD_DEBUG 0
@@ -43,38 +44,88 @@
 #endif
 #endif
 
+static inline int tiny_fd_queue_small_slot_size(tiny_fd_queue_t *queue)
+{
+    return queue->small_mtu + sizeof(tiny_fd_frame_info_t) - sizeof(((tiny_fd_frame_info_t *)0)->payload);
+}
+
 int tiny_fd_queue_init(tiny_fd_queue_t *queue, uint8_t *buffer,
                        int max_size, int max_frames, int mtu)
 {
-    uint8_t *ptr = buffer;
-    queue->frames = (tiny_fd_frame_info_t **)(ptr);
-    ptr += sizeof(tiny_fd_frame_info_t *) * max_frames;
-    /* At this point we still have correct alignment in the buffer if init->window_frames is even.
-     * pointer is 4 bytes on ARM 32-bit, and if window_frames is even, that gives us multiply of 8.
-     */
-    queue->size = max_frames;
-    /* Lets allocate memory for TX frames, we have <window_frames> TX frames */
-    for ( int i = 0; i < queue->size; i++ )
+    return tiny_fd_queue_init_ex(queue, buffer, max_size, max_frames, mtu, 0, 0);
+}
+
+int tiny_fd_queue_init_ex(tiny_fd_queue_t *queue, uint8_t *buffer,
+                          int max_size, int max_frames, int mtu, int small_frames, int small_mtu)
+{
+    const int slot_size = mtu + sizeof(tiny_fd_frame_info_t) - sizeof(((tiny_fd_frame_info_t *)0)->payload);
+    if ( small_frames < 0 || small_frames >= max_frames || max_frames > INT8_MAX || slot_size > UINT16_MAX ||
+         (small_frames && (small_mtu <= 0 || small_mtu >= mtu)) )
     {
-        queue->frames[i] = (tiny_fd_frame_info_t *)ptr;
-        /* mtu must be correctly aligned also, so the developer must use only mtu multiple of 8 on 32-bit ARM systems */
-        ptr += mtu + sizeof(tiny_fd_frame_info_t) - sizeof(((tiny_fd_frame_info_t *)0)->payload);
+        LOG(TINY_LOG_CRIT, "Invalid queue configuration: %i slots of %i bytes, %i small slots of %i bytes\n",
+            max_frames, mtu, small_frames, small_mtu);
+        return TINY_ERR_INVALID_DATA;
     }
-    if ( ptr > buffer + max_size )
+    queue->slots = buffer;
+    queue->mtu = mtu;
+    queue->slot_size = (uint16_t)slot_size;
+    queue->small_mtu = (uint16_t)(small_frames ? small_mtu : 0);
+    queue->size = (uint8_t)max_frames;
+    queue->small_index = (uint8_t)(max_frames - small_frames);
+    /* TX frames go one by one: full-size slots first, then small ones. mtu must be correctly aligned also,
+     * so the developer must use only mtu multiple of 8 on 32-bit ARM systems */
+    int size = queue->small_index * slot_size + small_frames * tiny_fd_queue_small_slot_size(queue);
+    if ( size > max_size )
     {
-        LOG(TINY_LOG_CRIT, "Queue out of provided memory: provided %i bytes, used %i bytes\n", max_size, (int)(ptr - buffer));
+        LOG(TINY_LOG_CRIT, "Queue out of provided memory: provided %i bytes, used %i bytes\n", max_size, size);
         return TINY_ERR_INVALID_DATA;
     }
-    queue->mtu = mtu;
     tiny_fd_queue_reset( queue );
-    return (int)(ptr - buffer);
+    return size;
+}
+
+/* Free slots are linked to FIFO list through len field, which is not used by free slots.
+ * Each size class has its own list. */
+static void tiny_fd_queue_push_free(tiny_fd_queue_t *queue, int index)
+{
+    tiny_fd_frame_info_t *frame = tiny_fd_queue_get_by_index(queue, index);
+    frame->type = TINY_FD_QUEUE_FREE;
+    frame->len = -1;
+    if ( index >= queue->small_index )
+    {
+        if ( queue->small_free_tail >= 0 )
+        {
+            tiny_fd_queue_get_by_index(queue, queue->small_free_tail)->len = index;
+        }
+        else
+        {
+            queue->small_free_head = (int8_t)index;
+        }
+        queue->small_free_tail = (int8_t)index;
+    }
+    else
+    {
+        if ( queue->free_tail >= 0 )
+        {
+            tiny_fd_queue_get_by_index(queue, queue->free_tail)->len = index;
+        }
+        else
+        {
+            queue->free_head = (int8_t)index;
+        }
+        queue->free_tail = (int8_t)index;
+    }
 }
 
 void tiny_fd_queue_reset(tiny_fd_queue_t *queue)
 {
+    queue->free_head = -1;
+    queue->free_tail = -1;
+    queue->small_free_head = -1;
+    queue->small_free_tail = -1;
     for (int i=0; i < queue->size; i++)
     {
-        queue->frames[i]->type = TINY_FD_QUEUE_FREE;
+        tiny_fd_queue_push_free(queue, i);
     }
     queue->lookup_index = 0;
 }
@@ -83,54 +134,67 @@ void tiny_fd_queue_reset_for(tiny_fd_queue_t *queue, uint8_t address)
 {
     for (int i=0; i < queue->size; i++)
     {
-        if ( ( queue->frames[i]->header.address & 0xFC ) == (address & 0xFC) )
+        tiny_fd_frame_info_t *frame = tiny_fd_queue_get_by_index(queue, i);
+        if ( frame->type != TINY_FD_QUEUE_FREE && frame->type != TINY_FD_QUEUE_RESERVED && frame->type != TINY_FD_QUEUE_SENDING &&
+             ( frame->header.address & 0xFC ) == (address & 0xFC) )
         {
-            queue->frames[i]->type = TINY_FD_QUEUE_FREE;
+            tiny_fd_queue_push_free(queue, i);
         }
     }
 }
 
 tiny_fd_frame_info_t *tiny_fd_queue_allocate(tiny_fd_queue_t *queue, uint8_t type, const uint8_t *data, int len)
 {
-    tiny_fd_frame_info_t *ptr = len <= queue->mtu ?  tiny_fd_queue_get_next(queue, TINY_FD_QUEUE_FREE, 0, 0) : NULL;
-    if ( ptr != NULL )
+    tiny_fd_frame_info_t *ptr;
+    if ( len <= queue->small_mtu && queue->small_free_head >= 0 )
+    {
+        ptr = tiny_fd_queue_get_by_index(queue, queue->small_free_head);
+        queue->small_free_head = (int8_t)ptr->len;
+        if ( queue->small_free_head < 0 )
+        {
+            queue->small_free_tail = -1;
+        }
+    }
+    else if ( len <= queue->mtu && queue->free_head >= 0 )
+    {
+        ptr = tiny_fd_queue_get_by_index(queue, queue->free_head);
+        queue->free_head = (int8_t)ptr->len;
+        if ( queue->free_head < 0 )
+        {
+            queue->free_tail = -1;
+        }
+    }
+    else
+    {
+        return NULL;
+    }
+    if ( data != NULL )
     {
         memcpy( &ptr->payload[0], data, len );
-        ptr->len = len;
-        ptr->type = type;
     }
+    ptr->len = len;
+    ptr->type = type;
     return ptr;
 }
 
-tiny_fd_frame_info_t *tiny_fd_queue_get_next(tiny_fd_queue_t *queue, uint8_t type, uint8_t address, uint8_t arg)
+tiny_fd_frame_info_t *tiny_fd_queue_get_next(tiny_fd_queue_t *queue, uint8_t type, uint8_t address)
 {
-    tiny_fd_frame_info_t *ptr = NULL;
     int index = queue->lookup_index;
     for (int i=0; i < queue->size; i++)
     {
-        // fprintf(stderr, "REC: type %02X address %02X, looking for type %02X addr %02X\n", queue->frames[index]->type, queue->frames[index]->header.address, type, address);
-        if ( queue->frames[index]->type & type )
+        tiny_fd_frame_info_t *ptr = tiny_fd_queue_get_by_index(queue, index);
+        // fprintf(stderr, "REC: type %02X address %02X, looking for type %02X addr %02X\n", ptr->type, ptr->header.address, type, address);
+        if ( ptr->type & type )
         {
-            if ( queue->frames[index]->type == TINY_FD_QUEUE_FREE )
+            if ( ptr->type == TINY_FD_QUEUE_FREE )
             {
-                ptr = queue->frames[index];
-                break;
+                return ptr;
             }
             // Check address for all frames
-            if ( (address & 0xFC) == (queue->frames[index]->header.address & 0xFC) )
+            if ( (address & 0xFC) == (ptr->header.address & 0xFC) )
             {
-                // fprintf(stderr, "REC FOUND: type %02X address %02X, looking for type %02X addr %02X\n", queue->frames[index]->type, queue->frames[index]->header.address, type, address);
-                if ( queue->frames[index]->type != TINY_FD_QUEUE_I_FRAME )
-                {
-                    ptr = queue->frames[index];
-                    break;
-                }
-                // Check for I-frame for the frame number
-                if ( ( ( queue->frames[index]->header.control >> 1 ) & 0x07 )  == arg )
-                {
-                    ptr = queue->frames[index];
-                    break;
-                }
+                // fprintf(stderr, "REC FOUND: type %02X address %02X, looking for type %02X addr %02X\n", ptr->type, ptr->header.address, type, address);
+                return ptr;
             }
         }
         index++;
@@ -139,31 +203,46 @@ tiny_fd_frame_info_t *tiny_fd_queue_get_next(tiny_fd_queue_t *queue, uint8_t typ
             index -= queue->size;
         }
     }
-    return ptr;
+    return NULL;
 }
 
-void tiny_fd_queue_free(tiny_fd_queue_t *queue, tiny_fd_frame_info_t *frame)
+int tiny_fd_queue_get_index(tiny_fd_queue_t *queue, const tiny_fd_frame_info_t *frame)
 {
-    tiny_fd_queue_free_by_header(queue, &frame->header);
+    // Slots of the same size class go one by one, so index is calculated from the frame address
+    int offset = (int)((const uint8_t *)frame - queue->slots);
+    int large_area = queue->small_index * queue->slot_size;
+    if ( offset < 0 )
+    {
+        return -1;
+    }
+    if ( offset < large_area )
+    {
+        return offset % queue->slot_size != 0 ? -1 : offset / queue->slot_size;
+    }
+    offset -= large_area;
+    int small_slot_size = tiny_fd_queue_small_slot_size(queue);
+    if ( offset % small_slot_size != 0 || offset / small_slot_size >= queue->size - queue->small_index )
+    {
+        return -1;
+    }
+    return queue->small_index + offset / small_slot_size;
 }
 
-void tiny_fd_queue_free_by_header(tiny_fd_queue_t *queue, const void *header)
+void tiny_fd_queue_free(tiny_fd_queue_t *queue, tiny_fd_frame_info_t *frame)
 {
-    for (int i=0; i < queue->size; i++)
+    int i = tiny_fd_queue_get_index(queue, frame);
+    if ( i >= 0 && tiny_fd_queue_get_by_index(queue, i)->type != TINY_FD_QUEUE_FREE )
     {
-        if ( &queue->frames[i]->header == header )
-        {
-            queue->frames[i]->type = TINY_FD_QUEUE_FREE;
-            queue->lookup_index = i + 1;
-            if ( queue->lookup_index >= queue->size )
-            {
-                queue->lookup_index -= queue->size;
-            }
-            break;
-        }
+        tiny_fd_queue_push_free(queue, i);
+        queue->lookup_index = (int8_t)(i + 1 < queue->size ? i + 1 : 0);
     }
 }
 
+void tiny_fd_queue_free_by_header(tiny_fd_queue_t *queue, const void *header)
+{
+    tiny_fd_queue_free(queue, tiny_fd_queue_get_by_header(header));
+}
+
 int tiny_fd_queue_get_mtu(tiny_fd_queue_t *queue)
 {
     return queue->mtu;
@@ -171,5 +250,10 @@ int tiny_fd_queue_get_mtu(tiny_fd_queue_t *queue)
 
 bool tiny_fd_queue_has_free_slots(tiny_fd_queue_t *queue)
 {
-    return tiny_fd_queue_get_next(queue, TINY_FD_QUEUE_FREE, 0, 0) != NULL;
+    return queue->free_head >= 0 || queue->small_free_head >= 0;
+}
+
+bool tiny_fd_queue_has_free_slots_for(tiny_fd_queue_t *queue, int len)
+{
+    return (len <= queue->small_mtu && queue->small_free_head >= 0) || (len <= queue->mtu && queue->free_head >= 0);
 }
@@ -39,13 +39,22 @@ extern "C"
 #include "hal/tiny_types.h"
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
     typedef struct
     {
-        tiny_fd_frame_info_t **frames;  ///< pointer to the frame table
-        int size;                       ///< number of elements in the table
-        int lookup_index;               ///< First index to start search from
+        uint8_t *slots;                 ///< frame slots, full-size slots go first, then small ones
         int mtu;                        ///< Maximum supported payload size
+        /* Queue holds up to INT8_MAX frames, so other fields are kept compact */
+        uint16_t slot_size;             ///< Distance between full-size frame slots in the buffer
+        uint16_t small_mtu;             ///< Maximum payload size of small slots, 0 if there are no small slots
+        uint8_t size;                   ///< number of slots in the queue
+        uint8_t small_index;            ///< Index of the first small slot, all slots before it hold mtu bytes
+        int8_t lookup_index;            ///< First index to start search from
+        int8_t free_head;               ///< Index of the first free slot, -1 if there are no free slots
+        int8_t free_tail;               ///< Index of the last free slot, -1 if there are no free slots
+        int8_t small_free_head;         ///< Index of the first free small slot, -1 if there are no free small slots
+        int8_t small_free_tail;         ///< Index of the last free small slot, -1 if there are no free small slots
     } tiny_fd_queue_t;
 
     typedef struct
@@ -54,6 +63,8 @@ extern "C"
         tiny_fd_queue_t i_queue;
         /// Storage for all S- and U- service frames
         tiny_fd_queue_t s_queue;
+        /// Storage for UI frames, located in the protocol buffer, or s_queue if UI frames share it
+        tiny_fd_queue_t *ui_queue;
         /// Global mutex
         tiny_mutex_t mutex;
 
@@ -72,13 +83,31 @@ extern "C"
     int tiny_fd_queue_init(tiny_fd_queue_t *queue, uint8_t *buffer,
                            int max_size, int max_frames, int mtu);
 
+    /**
+     * Initializes the queue with two slot size classes, and returns number of bytes allocated
+     * in the provided buffer. The last small_frames slots can hold only small_mtu bytes of payload,
+     * other slots hold up to mtu bytes. Small frames are placed to small slots first, and take
+     * full-size slots only if there are no free small slots.
+     * In case of error returns negative values (error codes)
+     *
+     * @param queue pointer to queue structure
+     * @param buffer buffer to store queue data
+     * @param max_size maximum size of the provided buffer
+     * @param max_frames maximum number of frames to store
+     * @param mtu maximum size of user payload
+     * @param small_frames number of small slots, must be less than max_frames
+     * @param small_mtu maximum size of user payload for small slots, must be less than mtu
+     */
+    int tiny_fd_queue_init_ex(tiny_fd_queue_t *queue, uint8_t *buffer,
+                              int max_size, int max_frames, int mtu, int small_frames, int small_mtu);
+
     /**
      * Resets the queue to its default state, flushes all stored frames
      */
     void tiny_fd_queue_reset(tiny_fd_queue_t *queue);
 
     /**
-     * Reset the queue only for specific address
+     * Reset the queue only for specific address. Reserved slots and slots being sent are not freed.
      */
     void tiny_fd_queue_reset_for(tiny_fd_queue_t *queue, uint8_t address);
 
@@ -87,6 +116,11 @@ extern "C"
      */
     bool tiny_fd_queue_has_free_slots(tiny_fd_queue_t *queue);
 
+    /**
+     * Returns true if the queue has free slot, which can hold len bytes of payload
+     */
+    bool tiny_fd_queue_has_free_slots_for(tiny_fd_queue_t *queue, int len);
+
     /**
      * Returns max payload size, supported for the queued frames
      */
@@ -95,19 +129,40 @@ extern "C"
     /**
      * Allocates free slot in the queue and copies user data to the queue.
      * If there are no space returns NULL, otherwise returns pointer to allocated frame info structure.
+     * If data is NULL, the slot for len bytes is allocated, but nothing is copied.
      */
     tiny_fd_frame_info_t *tiny_fd_queue_allocate(tiny_fd_queue_t *queue, uint8_t type, const uint8_t *data, int len);
 
     /**
-     * Returns pointer to the next element with speciifed type and arg or NULL.
+     * Returns pointer to the next element with speciifed type and address or NULL.
+     * I-frames are not searched here, they are found via N(S) to slot map of the peer.
      *
      * @param queue pointer to queue structure
      * @param type type of the record to search for: tiny_fd_queue_type_t
-     * @param arg arg used as the address field only for I-frame and must contain frame number to search for.
+     * @param address address field of the frame to search for
      *
      * @important Remember that S-Frames and U-Frames can be reordered by the queue.
      */
-    tiny_fd_frame_info_t *tiny_fd_queue_get_next(tiny_fd_queue_t *queue, uint8_t type, uint8_t address, uint8_t arg);
+    tiny_fd_frame_info_t *tiny_fd_queue_get_next(tiny_fd_queue_t *queue, uint8_t type, uint8_t address);
+
+    /**
+     * Returns index of the frame slot in the queue, or -1 if the frame doesn't belong to the queue
+     */
+    int tiny_fd_queue_get_index(tiny_fd_queue_t *queue, const tiny_fd_frame_info_t *frame);
+
+    /**
+     * Returns frame slot by its index in the queue
+     */
+    static inline tiny_fd_frame_info_t *tiny_fd_queue_get_by_index(tiny_fd_queue_t *queue, int index)
+    {
+        // Slots of the same size class go one by one, so the slot address is calculated from the index
+        if ( index < queue->small_index )
+        {
+            return (tiny_fd_frame_info_t *)(queue->slots + index * queue->slot_size);
+        }
+        return (tiny_fd_frame_info_t *)(queue->slots + queue->small_index * queue->slot_size +
+                                        (index - queue->small_index) * (queue->slot_size - queue->mtu + queue->small_mtu));
+    }
 
     /**
      * Marks frame slot as free
@@ -125,6 +180,14 @@ extern "C"
      */
     void tiny_fd_queue_free_by_header(tiny_fd_queue_t *queue, const void *header);
 
+    /**
+     * Returns frame slot, containing specified header
+     */
+    static inline tiny_fd_frame_info_t *tiny_fd_queue_get_by_header(const void *header)
+    {
+        return (tiny_fd_frame_info_t *)((const uint8_t *)header - offsetof(tiny_fd_frame_info_t, header));
+    }
+
 #ifdef __cplusplus
 }
 #endif
@@ -33,6 +33,32 @@
 #include "tiny_fd_defines_int.h"
 #include "tiny_fd_peers_int.h"
 
+#include <string.h>
+
+///////////////////////////////////////////////////////////////////////////////
+
+int __i_queue_control_slots_size(int window_frames)
+{
+    // Sequence numbers of frames in the window are consecutive, so N(S) modulo power of 2
+    // not less than the window gives unique index for each of them.
+    int size = 1;
+    while ( size < window_frames )
+    {
+        size <<= 1;
+    }
+    return size;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void __init_i_queue_control(i_queue_control_t *control, uint8_t seq_mask, uint8_t *slots, int slots_size)
+{
+    control->seq_mask = seq_mask;
+    control->slots = slots;
+    control->tx_state.slots_mask = (uint8_t)(slots_size - 1);
+    __reset_i_queue_control( control );
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 bool __i_queue_control_confirm_sent_frames(i_queue_control_t *control, uint8_t nr, on_i_frame_to_process_cb_t cb, void *ctx)
@@ -55,7 +81,7 @@ bool __i_queue_control_confirm_sent_frames(i_queue_control_t *control, uint8_t n
             // TODO: Add error processing
             LOG(TINY_LOG_ERR, "[%p] The frame cannot be confirmed: %02X\n", control, __i_queue_control_get_next_frame_to_confirm( control ));
         }
-        control->tx_state.confirm_ns = (control->tx_state.confirm_ns + 1) & seq_bits_mask;
+        control->tx_state.confirm_ns = (control->tx_state.confirm_ns + 1) & control->seq_mask;
     }
     LOG(TINY_LOG_DEB, "[%p] Last confirmed frame: %02X\n", control, control->tx_state.confirm_ns);
     // Check if we can accept new frames from the application.
@@ -85,7 +111,7 @@ bool __i_queue_control_restransmit_frame(i_queue_control_t *control, uint8_t nr,
             __put_u_s_frame_to_tx_queue(handle, TINY_FD_QUEUE_U_FRAME, &frame, 4);*/
             break;
         }
-        control->tx_state.next_ns = (control->tx_state.next_ns - 1) & seq_bits_mask;
+        control->tx_state.next_ns = (control->tx_state.next_ns - 1) & control->seq_mask;
     }
     LOG(TINY_LOG_DEB, "[%p] N(s) is set to %02X\n", control, control->tx_state.next_ns);
 //    tiny_events_set(&handle->events, FD_EVENT_TX_DATA_AVAILABLE);
@@ -103,14 +129,14 @@ uint8_t __i_queue_control_get_next_frame_to_send(i_queue_control_t *control)
 
 void __i_queue_control_move_to_next_ns(i_queue_control_t *control)
 {
-    control->tx_state.next_ns = (control->tx_state.next_ns + 1) & seq_bits_mask;
+    control->tx_state.next_ns = (control->tx_state.next_ns + 1) & control->seq_mask;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 void __i_queue_control_move_to_previous_ns(i_queue_control_t *control)
 {
-    control->tx_state.next_ns = (control->tx_state.next_ns - 1) & seq_bits_mask;
+    control->tx_state.next_ns = (control->tx_state.next_ns - 1) & control->seq_mask;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -131,24 +157,43 @@ bool __all_frames_are_sent(i_queue_control_t *control)
 
 bool __i_queue_control_tx_full(i_queue_control_t *control)
 {
-    uint8_t next_last_ns = (control->tx_state.last_ns + 1) & seq_bits_mask;
+    uint8_t next_last_ns = (control->tx_state.last_ns + 1) & control->seq_mask;
     bool can_accept = next_last_ns != control->tx_state.confirm_ns;
     return !can_accept;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
+uint8_t __i_queue_control_queued_frames(i_queue_control_t *control)
+{
+    return (control->tx_state.last_ns - control->tx_state.confirm_ns) & control->seq_mask;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool __peer_can_accept_i_frames(tiny_fd_handle_t handle, uint8_t peer)
+{
+    i_queue_control_t *control = &handle->peers[peer].i_queue_control;
+    // While the application writes to reserved slot, other frames to the peer wait for commit
+    if ( handle->peers[peer].reserved_slot != I_QUEUE_CONTROL_NO_SLOT || __i_queue_control_tx_full( control ) )
+    {
+        return false;
+    }
+    return !handle->peer_tx_quota || __i_queue_control_queued_frames( control ) < handle->peer_tx_quota;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 bool __put_i_frame_to_tx_queue(tiny_fd_handle_t handle, uint8_t peer, const void *data, int len)
 {
-    tiny_fd_frame_info_t *slot = tiny_fd_queue_allocate( &handle->frames.i_queue, TINY_FD_QUEUE_I_FRAME, (const uint8_t *)data, len );
+    // In extended mode the second byte of control field goes ahead of user payload
+    tiny_fd_frame_info_t *slot = tiny_fd_queue_allocate( &handle->frames.i_queue, TINY_FD_QUEUE_I_FRAME, NULL,
+                                                         len + handle->ext_control );
     // Check if space is actually available
     if ( slot != NULL )
     {
-        LOG(TINY_LOG_DEB, "[%p] QUEUE I-PUT: [%02X] [%02X]\n", handle, slot->header.address, slot->header.control);
-        slot->header.address = __peer_to_address_field( handle, peer );
-        slot->header.control = handle->peers[peer].i_queue_control.tx_state.last_ns << 1;
-        handle->peers[peer].i_queue_control.tx_state.last_ns = (handle->peers[peer].i_queue_control.tx_state.last_ns + 1) & seq_bits_mask;
-        tiny_events_set(&handle->events, FD_EVENT_TX_DATA_AVAILABLE);
+        memcpy( &slot->payload[handle->ext_control], data, len );
+        __enqueue_i_frame_slot( handle, peer, slot );
         return true;
     }
     return false;
@@ -156,11 +201,128 @@ bool __put_i_frame_to_tx_queue(tiny_fd_handle_t handle, uint8_t peer, const void
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void __enqueue_i_frame_slot(tiny_fd_handle_t handle, uint8_t peer, tiny_fd_frame_info_t *slot)
+{
+    i_queue_control_t *control = &handle->peers[peer].i_queue_control;
+    i_queue_control_send_t *tx_state = &control->tx_state;
+    LOG(TINY_LOG_DEB, "[%p] QUEUE I-PUT: [%02X] [%02X]\n", handle, slot->header.address, slot->header.control);
+    slot->type = TINY_FD_QUEUE_I_FRAME;
+    slot->header.address = __peer_to_address_field( handle, peer );
+    slot->header.control = tx_state->last_ns << 1;
+    if ( handle->ext_control )
+    {
+        // N(R) is set when the frame is sent
+        slot->payload[0] = 0;
+    }
+    control->slots[tx_state->last_ns & tx_state->slots_mask] = (uint8_t)tiny_fd_queue_get_index( &handle->frames.i_queue, slot );
+    tx_state->last_ns = (tx_state->last_ns + 1) & control->seq_mask;
+    tiny_events_set(&handle->events, FD_EVENT_TX_DATA_AVAILABLE);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+uint8_t __i_queue_free_slots_event_for(tiny_fd_handle_t handle, int len)
+{
+    tiny_fd_queue_t *queue = &handle->frames.i_queue;
+    len += handle->ext_control;
+    return queue->small_mtu && len <= queue->small_mtu ? FD_EVENT_QUEUE_HAS_FREE_SMALL_SLOTS : FD_EVENT_QUEUE_HAS_FREE_SLOTS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void __update_i_queue_free_slots_events(tiny_fd_handle_t handle)
+{
+    tiny_fd_queue_t *queue = &handle->frames.i_queue;
+    uint8_t events = tiny_fd_queue_has_free_slots_for( queue, queue->mtu ) ? FD_EVENT_QUEUE_HAS_FREE_SLOTS : 0;
+    if ( queue->small_mtu && tiny_fd_queue_has_free_slots_for( queue, queue->small_mtu ) )
+    {
+        events |= FD_EVENT_QUEUE_HAS_FREE_SMALL_SLOTS;
+    }
+    tiny_events_clear( &handle->events, (FD_EVENT_QUEUE_HAS_FREE_SLOTS | FD_EVENT_QUEUE_HAS_FREE_SMALL_SLOTS) & ~events );
+    if ( events )
+    {
+        tiny_events_set( &handle->events, events );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+tiny_fd_frame_info_t *__get_i_frame_from_tx_queue(tiny_fd_handle_t handle, uint8_t peer, uint8_t ns)
+{
+    i_queue_control_t *control = &handle->peers[peer].i_queue_control;
+    uint8_t index = control->slots[ns & control->tx_state.slots_mask] & ~I_QUEUE_CONTROL_SREJ_FLAG;
+    if ( index == I_QUEUE_CONTROL_NO_SLOT )
+    {
+        return NULL;
+    }
+    tiny_fd_frame_info_t *slot = tiny_fd_queue_get_by_index( &handle->frames.i_queue, index );
+    if ( slot->type != TINY_FD_QUEUE_I_FRAME ||
+         (slot->header.address & 0xFC) != (__peer_to_address_field( handle, peer ) & 0xFC) ||
+         ((slot->header.control >> 1) & control->seq_mask) != (ns & control->seq_mask) )
+    {
+        // Index is out of sync with the queue, that should never happen
+        LOG(TINY_LOG_ERR, "[%p] I-queue index has no frame N(S)=%02X\n", handle, ns);
+        return NULL;
+    }
+    return slot;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void __free_i_frame_from_tx_queue(tiny_fd_handle_t handle, uint8_t peer, uint8_t ns)
+{
+    tiny_fd_frame_info_t *slot = __get_i_frame_from_tx_queue( handle, peer, ns );
+    if ( slot != NULL )
+    {
+        tiny_fd_queue_free( &handle->frames.i_queue, slot );
+    }
+    i_queue_control_t *control = &handle->peers[peer].i_queue_control;
+    control->slots[ns & control->tx_state.slots_mask] = I_QUEUE_CONTROL_NO_SLOT;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool __request_i_frame_retransmit(tiny_fd_handle_t handle, uint8_t peer, uint8_t ns)
+{
+    i_queue_control_t *control = &handle->peers[peer].i_queue_control;
+    uint8_t *index = &control->slots[ns & control->tx_state.slots_mask];
+    if ( *index == I_QUEUE_CONTROL_NO_SLOT || (*index & I_QUEUE_CONTROL_SREJ_FLAG) )
+    {
+        return false;
+    }
+    *index |= I_QUEUE_CONTROL_SREJ_FLAG;
+    handle->peers[peer].srej_pending++;
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+tiny_fd_frame_info_t *__get_requested_i_frame_from_tx_queue(tiny_fd_handle_t handle, uint8_t peer)
+{
+    i_queue_control_t *control = &handle->peers[peer].i_queue_control;
+    for ( uint8_t ns = control->tx_state.confirm_ns; ns != control->tx_state.next_ns; ns = (ns + 1) & control->seq_mask )
+    {
+        uint8_t *index = &control->slots[ns & control->tx_state.slots_mask];
+        if ( *index & I_QUEUE_CONTROL_SREJ_FLAG )
+        {
+            *index &= ~I_QUEUE_CONTROL_SREJ_FLAG;
+            handle->peers[peer].srej_pending--;
+            return __get_i_frame_from_tx_queue( handle, peer, ns );
+        }
+    }
+    // Requested frames are confirmed already, or go back to the queue after REJ
+    handle->peers[peer].srej_pending = 0;
+    return NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void __reset_i_queue_control(i_queue_control_t *control)
 {
     control->tx_state.confirm_ns = 0;
     control->tx_state.last_ns = 0;
     control->tx_state.next_ns = 0;
+    memset(control->slots, I_QUEUE_CONTROL_NO_SLOT, control->tx_state.slots_mask + 1);
 
     control->rx_state.next_nr = 0;
 }
@@ -192,7 +354,7 @@ uint8_t __i_queue_control_get_next_frame_to_receive(i_queue_control_t *control)
 
 void __i_queue_control_move_to_next_frame_to_receive(i_queue_control_t *control)
 {
-    control->rx_state.next_nr = (control->rx_state.next_nr + 1) & seq_bits_mask;
+    control->rx_state.next_nr = (control->rx_state.next_nr + 1) & control->seq_mask;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -30,14 +30,21 @@
 
 #include "tiny_fd.h"
 #include "tiny_fd_defines_int.h"
+#include "tiny_fd_frames_int.h"
 
 #include <stdbool.h>
 
+// Marks sequence number, which has no frame in the I-queue
+#define I_QUEUE_CONTROL_NO_SLOT 0x7F
+// Marks sequence number, which frame is requested by SREJ for selective retransmission
+#define I_QUEUE_CONTROL_SREJ_FLAG 0x80
+
 typedef struct i_queue_control_send_t
 {
     uint8_t last_ns;     // next free frame to send in cycle buffer
     uint8_t confirm_ns;  // next sent frame to be confirmed
     uint8_t next_ns;     // next frame to be sent
+    uint8_t slots_mask;  // size of slots map minus 1, the size is power of 2 to cover the whole window
 } i_queue_control_send_t;
 
 typedef struct i_queue_control_recv_t
@@ -47,8 +54,10 @@ typedef struct i_queue_control_recv_t
 
 typedef struct i_queue_control_t
 {
+    uint8_t *slots;      // I-queue slot index for each N(S), I_QUEUE_CONTROL_NO_SLOT if there is no frame
     struct i_queue_control_send_t tx_state;
     struct i_queue_control_recv_t rx_state;
+    uint8_t seq_mask;    // HDLC_SEQ_MASK for modulo 8 sequence numbers, HDLC_EXT_SEQ_MASK for modulo 128
 } i_queue_control_t;
 
 typedef bool (*on_i_frame_to_process_cb_t)(void *ctx, uint8_t nr);
@@ -62,6 +71,14 @@ static inline uint8_t __i_queue_control_get_next_frame_to_confirm(i_queue_contro
 
 ///////////////////////////////////////////////////////////////////////////////
 
+int __i_queue_control_slots_size(int window_frames);
+
+///////////////////////////////////////////////////////////////////////////////
+
+void __init_i_queue_control(i_queue_control_t *control, uint8_t seq_mask, uint8_t *slots, int slots_size);
+
+///////////////////////////////////////////////////////////////////////////////
+
 bool __i_queue_control_confirm_sent_frames(i_queue_control_t *control, uint8_t nr, on_i_frame_to_process_cb_t cb, void *ctx);
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -102,10 +119,46 @@ bool __i_queue_control_tx_full(i_queue_control_t *control);
 
 ///////////////////////////////////////////////////////////////////////////////
 
+uint8_t __i_queue_control_queued_frames(i_queue_control_t *control);
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool __peer_can_accept_i_frames(tiny_fd_handle_t handle, uint8_t peer);
+
+///////////////////////////////////////////////////////////////////////////////
+
 bool __put_i_frame_to_tx_queue(tiny_fd_handle_t handle, uint8_t peer, const void *data, int len);
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void __enqueue_i_frame_slot(tiny_fd_handle_t handle, uint8_t peer, tiny_fd_frame_info_t *slot);
+
+///////////////////////////////////////////////////////////////////////////////
+
+uint8_t __i_queue_free_slots_event_for(tiny_fd_handle_t handle, int len);
+
+///////////////////////////////////////////////////////////////////////////////
+
+void __update_i_queue_free_slots_events(tiny_fd_handle_t handle);
+
+///////////////////////////////////////////////////////////////////////////////
+
+tiny_fd_frame_info_t *__get_i_frame_from_tx_queue(tiny_fd_handle_t handle, uint8_t peer, uint8_t ns);
+
+///////////////////////////////////////////////////////////////////////////////
+
+void __free_i_frame_from_tx_queue(tiny_fd_handle_t handle, uint8_t peer, uint8_t ns);
+
+///////////////////////////////////////////////////////////////////////////////
+
+bool __request_i_frame_retransmit(tiny_fd_handle_t handle, uint8_t peer, uint8_t ns);
+
+///////////////////////////////////////////////////////////////////////////////
+
+tiny_fd_frame_info_t *__get_requested_i_frame_from_tx_queue(tiny_fd_handle_t handle, uint8_t peer);
+
+///////////////////////////////////////////////////////////////////////////////
+
 void __reset_i_queue_control(i_queue_control_t *control);
 
 ///////////////////////////////////////////////////////////////////////////////
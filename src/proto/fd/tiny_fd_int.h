@@ -44,23 +44,28 @@ extern "C"
 #include "tiny_fd_i_queue_control_int.h"
 #include "tiny_fd_frames_queue_int.h"
 
-#define FD_PEER_BUF_SIZE() ( sizeof(tiny_fd_peer_info_t) )
+// Peer data and N(S) to I-queue slots map, which size is power of 2 not more than 2 * window
+#define FD_PEER_BUF_SIZE(window) ( sizeof(tiny_fd_peer_info_t) + 2 * (window) + TINY_ALIGN_STRUCT_VALUE - 1 )
 
+/* FD_MIN_BUF_SIZE() and FD_BUF_SIZE_EX() are compile-time equivalents of tiny_fd_buffer_size_by_mtu() and
+ * tiny_fd_buffer_size_by_mtu_ex() for single peer. They do not count optional features: extended mode,
+ * small tx slots, UI queue, selective repeat, messages and hdlc tx queue. Use tiny_fd_buffer_size_by_init()
+ * for such configurations. */
 #define FD_MIN_BUF_SIZE(mtu, window)                                                                                   \
     (sizeof(tiny_fd_data_t) + TINY_ALIGN_STRUCT_VALUE - 1 + \
      HDLC_MIN_BUF_SIZE(mtu + sizeof(tiny_frame_header_t), HDLC_CRC_16) +                     \
-      ( 1 * FD_PEER_BUF_SIZE() ) + \
-      (sizeof(tiny_fd_frame_info_t *) + sizeof(tiny_fd_frame_info_t) + mtu \
+      ( 1 * FD_PEER_BUF_SIZE(window) ) + \
+      (sizeof(tiny_fd_frame_info_t) + mtu \
                                       - sizeof(((tiny_fd_frame_info_t *)0)->payload) ) * window + \
-          ( sizeof(tiny_fd_frame_info_t) + sizeof(tiny_fd_frame_info_t *) ) * TINY_FD_U_QUEUE_MAX_SIZE )
+          sizeof(tiny_fd_frame_info_t) * TINY_FD_U_QUEUE_MAX_SIZE )
 
 #define FD_BUF_SIZE_EX(mtu, tx_window, crc, rx_window)                                                                      \
     (sizeof(tiny_fd_data_t) + TINY_ALIGN_STRUCT_VALUE - 1 + \
      HDLC_BUF_SIZE_EX(mtu + sizeof(tiny_frame_header_t), crc, rx_window) +           \
-      ( 1 * FD_PEER_BUF_SIZE() ) + \
-      (sizeof(tiny_fd_frame_info_t *) + sizeof(tiny_i_frame_info_t) + mtu \
+      ( 1 * FD_PEER_BUF_SIZE(tx_window) ) + \
+      (sizeof(tiny_fd_frame_info_t) + mtu \
                                       - sizeof(((tiny_fd_frame_info_t *)0)->payload)) * tx_window + \
-       ( sizeof(tiny_fd_frame_info_t) + sizeof(tiny_fd_frame_info_t *) ) * TINY_FD_U_QUEUE_MAX_SIZE)
+       sizeof(tiny_fd_frame_info_t) * TINY_FD_U_QUEUE_MAX_SIZE)
 
     typedef enum
     {
@@ -80,21 +85,49 @@ extern "C"
 
     typedef struct
     {
-        /// state of hdlc protocol according to ISO & RFC
-        tiny_fd_state_t state;
+        uint8_t *data;  // I-frame in held HDLC RX slot, NULL if the record is free
+        uint16_t len;
+        uint8_t peer;
+        uint8_t ns;
+    } tiny_fd_rx_frame_t;
+
+    typedef struct
+    {
+        uint8_t *data;     // Reassembly buffer
+        int size;          // Size of reassembly buffer
+        int len;           // Number of message bytes collected
+        uint8_t active;    // If the first fragment is received, and the last one is not yet
+        uint8_t overflow;  // If the message doesn't fit the reassembly buffer, and is dropped
+    } tiny_fd_rx_message_t;
+
+    typedef struct
+    {
+        /// state of hdlc protocol according to ISO & RFC: tiny_fd_state_t value
+        uint8_t state;
         uint8_t addr;        // Peer address
 
         uint8_t sent_nr;     // frame index last sent back
         uint8_t sent_reject; // If reject was already sent
-        uint8_t srej_req_mask; // Bitmask of frames requested for selective retransmission
+        uint8_t rx_withheld; // If I-frame was dropped, since all RX slots were on loan
+        uint8_t srej_pending;  // Number of frames, marked for selective retransmission in I-queue slots map
+        uint8_t reserved_slot; // I-queue slot reserved by tiny_fd_tx_reserve(), I_QUEUE_CONTROL_NO_SLOT if none
+        uint8_t remote_busy;   // If peer signalled RNR, I-frames are not sent until RR, REJ or SREJ
+        uint8_t rtt_state;     // FD_RTT_IDLE, FD_RTT_TIMING or FD_RTT_HOLDOFF, combined with FD_RTT_SAMPLED flag
+        uint8_t checkpoint_ns; // N(S) following I-frame with P bit, FD_NO_CHECKPOINT if F answer is not expected, or FD_STALE_CHECKPOINT
+        uint8_t ka_confirmed;
+        uint8_t retries;     // Number of retries to perform before timeout takes place
 
-        i_queue_control_t i_queue_control;
+        /* Fields are ordered by size to keep the structure compact, since it is allocated per peer */
+        uint16_t deficit;    // Payload bytes the peer still can get during current marker turn
+        uint16_t rto;        // I-frame retransmission timeout in milliseconds
+        uint16_t srtt;       // Smoothed round trip time in milliseconds, valid if FD_RTT_SAMPLED is set
+        uint16_t rttvar;     // Round trip time variation in milliseconds
 
         uint32_t last_sent_i_ts;           // last sent I-frame timestamp
         uint32_t last_sent_frame_ts;       // last sent keep alive timestamp
         uint32_t last_received_frame_ts;   // last keep alive timestamp
-        uint8_t ka_confirmed;
-        uint8_t retries;     // Number of retries to perform before timeout takes place
+
+        i_queue_control_t i_queue_control;
 
         tiny_events_t events;
 
@@ -102,7 +135,7 @@ extern "C"
 
     typedef struct tiny_fd_data_t
     {
-        /// Callback to process received frames
+        /// Callback to process received frames, or reassembled messages if messages are used
         on_frame_read_cb_t on_read_cb;
         /// Callback to process received frames
         on_frame_send_cb_t on_send_cb;
@@ -116,32 +149,153 @@ extern "C"
         hdlc_ll_handle_t _hdlc;
         /// Timeout for operations with acknowledge
         uint16_t send_timeout;
-        /// Timeout before retrying resend I-frames
+        /// Timeout before retrying resend I-frames, initial value of adaptive retransmission timeout
         uint16_t retry_timeout;
+        /// Lower bound of adaptive retransmission timeout
+        uint16_t rto_min;
+        /// Upper bound of adaptive retransmission timeout, 0 if retry_timeout is always used
+        uint16_t rto_max;
         /// Timeout before sending keep alive HDLC frame (RR)
         uint16_t ka_timeout;
         /// Number of retries to perform before timeout takes place
         uint8_t retries;
-        /// Information for frames being processed
-        tiny_frames_queue_t frames;
+        /// Number of in-sequence I-frames, acknowledged by single RR frame
+        uint8_t ack_frames;
+        /// Last I-frame, which can be sent, polls the peer in ABM mode
+        uint8_t checkpointing;
         /// Peers count supported by the primary device
         uint8_t peers_count;
+        /// I-frames carry fragments of messages, reassembled in buffers of the peers
+        uint8_t messages;
+        /// Frames, returned by hdlc_ll_tx_purge(), go back to the queues instead of being freed
+        uint8_t tx_purge;
+        /// Information for frames being processed
+        tiny_frames_queue_t frames;
         /// Information on all peers stations
         tiny_fd_peer_info_t *peers;
         /// Local address: 0x00 or for primary devices
         uint8_t addr;
         /// Next peer to process
         uint8_t next_peer;
+        /// Maximum number of I-frames queued for single peer, 0 if not limited
+        uint8_t peer_tx_quota;
+        /// Number of free RX slots, which makes the station busy
+        uint8_t rx_low_water;
+        /// Deficit round robin quantum in bytes, 0 if not used
+        uint16_t peer_quantum;
+        /// Maximum time to delay RR frame, 0 if each I-frame is acknowledged immediately
+        uint16_t ack_delay;
         /// Last marker timestamp
         uint32_t last_marker_ts;
         /// HDLC mode;
         uint8_t mode;
+        /// Extra control field bytes of I- and S-frames: 1 for modulo 128 sequence numbers, 0 otherwise
+        uint8_t ext_control;
+        /// Number of records for out of order I-frames, 0 if selective repeat is not used
+        uint8_t rx_reorder_count;
+        /// Free RX slots dropped to rx_low_water, so RNR is sent to peers instead of RR
+        uint8_t local_busy;
         /// Global events for HDLC protocol
         tiny_events_t events;
         /// user specific data
         void *user_data;
     } tiny_fd_data_t;
 
+    /// Records of out of order I-frames, waiting for missing ones, are located right after peers data
+    static inline tiny_fd_rx_frame_t *__rx_reorder_frames(tiny_fd_handle_t handle)
+    {
+        return (tiny_fd_rx_frame_t *)(handle->peers + handle->peers_count);
+    }
+
+    /// Records of messages being reassembled, one per peer, follow records of out of order frames
+    static inline tiny_fd_rx_message_t *__rx_messages(tiny_fd_handle_t handle)
+    {
+        return (tiny_fd_rx_message_t *)(__rx_reorder_frames( handle ) + handle->rx_reorder_count);
+    }
+
+    /// Returns RR, or RNR if the station cannot accept I-frames at the moment
+    static inline uint8_t __rx_ready_frame_type(tiny_fd_handle_t handle)
+    {
+        return handle->local_busy ? HDLC_S_FRAME_TYPE_RNR : HDLC_S_FRAME_TYPE_RR;
+    }
+
+    static inline uint8_t __seq_mask(tiny_fd_handle_t handle)
+    {
+        return handle->ext_control ? HDLC_EXT_SEQ_MASK : HDLC_SEQ_MASK;
+    }
+
+    /// Returns true if the frame has 2-byte control field: I- and S-frames in extended mode
+    static inline bool __frame_has_ext_control(tiny_fd_handle_t handle, const uint8_t *data)
+    {
+        return handle->ext_control && (data[1] & HDLC_U_FRAME_MASK) != HDLC_U_FRAME_BITS;
+    }
+
+    /// Returns size of address and control fields of the frame
+    static inline int __frame_header_size(tiny_fd_handle_t handle, const uint8_t *data)
+    {
+        return (int)sizeof(tiny_frame_header_t) + (__frame_has_ext_control( handle, data ) ? 1 : 0);
+    }
+
+    static inline uint8_t __frame_ns(tiny_fd_handle_t handle, const uint8_t *data)
+    {
+        return (data[1] >> 1) & __seq_mask( handle );
+    }
+
+    static inline uint8_t __frame_nr(tiny_fd_handle_t handle, const uint8_t *data)
+    {
+        return handle->ext_control ? (data[2] >> 1) : (data[1] >> 5);
+    }
+
+    /// Sets N(R) of I- or S-frame, P/F bit is cleared
+    static inline void __frame_set_nr(tiny_fd_handle_t handle, uint8_t *data, uint8_t nr)
+    {
+        if ( handle->ext_control )
+        {
+            data[2] = nr << 1;
+        }
+        else
+        {
+            data[1] = (data[1] & 0x0F) | (nr << 5);
+        }
+    }
+
+    static inline bool __frame_pf(tiny_fd_handle_t handle, const uint8_t *data)
+    {
+        return __frame_has_ext_control( handle, data ) ? (data[2] & HDLC_EXT_PF_BIT) : (data[1] & HDLC_P_BIT);
+    }
+
+    static inline void __frame_set_pf(tiny_fd_handle_t handle, uint8_t *data)
+    {
+        if ( __frame_has_ext_control( handle, data ) )
+        {
+            data[2] |= HDLC_EXT_PF_BIT;
+        }
+        else
+        {
+            data[1] |= HDLC_P_BIT;
+        }
+    }
+
+    /// Returns U-frame type, which sets up the link in configured mode: SABM, SNRM, SABME or SNRME
+    static inline uint8_t __set_mode_frame_type(tiny_fd_handle_t handle)
+    {
+        if ( handle->ext_control )
+        {
+            return handle->mode == TINY_FD_MODE_NRM ? HDLC_U_FRAME_TYPE_SNRME : HDLC_U_FRAME_TYPE_SABME;
+        }
+        return handle->mode == TINY_FD_MODE_NRM ? HDLC_U_FRAME_TYPE_SNRM : HDLC_U_FRAME_TYPE_SABM;
+    }
+
+    /// Returns true if U-frame type requests the link in the sequence numbering mode of the station
+    static inline bool __is_set_mode_frame_type(tiny_fd_handle_t handle, uint8_t type)
+    {
+        if ( handle->ext_control )
+        {
+            return type == HDLC_U_FRAME_TYPE_SABME || type == HDLC_U_FRAME_TYPE_SNRME;
+        }
+        return type == HDLC_U_FRAME_TYPE_SABM || type == HDLC_U_FRAME_TYPE_SNRM;
+    }
+
     extern void __tiny_fd_log_frame(
                         tiny_fd_handle_t handle,
                        tiny_fd_frame_direction_t direction,
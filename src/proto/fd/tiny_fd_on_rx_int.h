@@ -36,13 +36,105 @@
 #include "tiny_fd_peers_int.h"
 #include "tiny_fd_service_queue_int.h"
 #include <stdint.h>
+#include <string.h>
 
 static void __switch_to_connected_state(tiny_fd_handle_t handle, uint8_t peer);
 static void __switch_to_disconnected_state(tiny_fd_handle_t handle, uint8_t peer);
 
 ///////////////////////////////////////////////////////////////////////////////
 
-static int __check_received_frame(tiny_fd_handle_t handle, uint8_t peer, uint8_t ns)
+static tiny_fd_rx_frame_t *__find_reordered_frame(tiny_fd_handle_t handle, uint8_t peer, uint8_t ns)
+{
+    for ( int i = 0; i < handle->rx_reorder_count; i++ )
+    {
+        tiny_fd_rx_frame_t *frame = &__rx_reorder_frames( handle )[i];
+        if ( frame->data && frame->peer == peer && frame->ns == ns )
+        {
+            return frame;
+        }
+    }
+    return NULL;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static bool __has_reordered_frames(tiny_fd_handle_t handle, uint8_t peer)
+{
+    for ( int i = 0; i < handle->rx_reorder_count; i++ )
+    {
+        if ( __rx_reorder_frames( handle )[i].data && __rx_reorder_frames( handle )[i].peer == peer )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void __drop_reordered_frames(tiny_fd_handle_t handle, uint8_t peer)
+{
+    for ( int i = 0; i < handle->rx_reorder_count; i++ )
+    {
+        tiny_fd_rx_frame_t *frame = &__rx_reorder_frames( handle )[i];
+        if ( frame->data && frame->peer == peer )
+        {
+            hdlc_ll_rx_release( handle->_hdlc, frame->data );
+            frame->data = NULL;
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void __drop_partial_message(tiny_fd_handle_t handle, uint8_t peer)
+{
+    if ( handle->messages )
+    {
+        __rx_messages( handle )[peer].active = 0;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static bool __hold_out_of_order_frame(tiny_fd_handle_t handle, uint8_t peer, uint8_t ns, uint8_t *data, int len)
+{
+    uint8_t seq_mask = __seq_mask( handle );
+    // Frames outside of the receive window (half of sequence space) are duplicates of already received ones
+    if ( ((ns - __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control)) & seq_mask) > (seq_mask >> 1) )
+    {
+        return false;
+    }
+    if ( __find_reordered_frame(handle, peer, ns) )
+    {
+        // Retransmitted copy of already buffered frame
+        return true;
+    }
+    tiny_fd_rx_frame_t *frame = NULL;
+    for ( int i = 0; i < handle->rx_reorder_count && !frame; i++ )
+    {
+        frame = __rx_reorder_frames( handle )[i].data ? NULL : &__rx_reorder_frames( handle )[i];
+    }
+    if ( !frame || hdlc_ll_rx_hold( handle->_hdlc, data ) != TINY_SUCCESS )
+    {
+        return false;
+    }
+    // One more RX slot must stay free, otherwise the missing frame cannot be delivered and held by the user
+    if ( !hdlc_ll_rx_can_hold( handle->_hdlc ) )
+    {
+        hdlc_ll_rx_release( handle->_hdlc, data );
+        return false;
+    }
+    frame->data = data;
+    frame->len = (uint16_t)len;
+    frame->peer = peer;
+    frame->ns = ns;
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static int __check_received_frame(tiny_fd_handle_t handle, uint8_t peer, uint8_t ns, uint8_t *data, int len)
 {
     int result = TINY_SUCCESS;
     if ( ns == __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control) )
@@ -55,6 +147,19 @@ static int __check_received_frame(tiny_fd_handle_t handle, uint8_t peer, uint8_t
         __i_queue_control_move_to_next_frame_to_receive(&handle->peers[peer].i_queue_control);
         handle->peers[peer].sent_reject = 0;
     }
+    else if ( handle->rx_reorder_count && __hold_out_of_order_frame(handle, peer, ns, data, len) )
+    {
+        // The frame is kept until the gap is filled. Only the first missing frame is requested by SREJ,
+        // next missing frames are requested when the frame is received.
+        LOG(TINY_LOG_WRN, "[%p] Out of order I-Frame N(s)=%d is buffered\n", handle, ns);
+        if ( !handle->peers[peer].sent_reject )
+        {
+            handle->peers[peer].sent_reject = 1;
+            __put_s_frame_to_tx_queue(handle, __peer_to_address_field( handle, peer ) | HDLC_CR_BIT, HDLC_S_FRAME_TYPE_SREJ,
+                                      __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control), false);
+        }
+        result = TINY_ERR_FAILED;
+    }
     else
     {
         // The frame we received is not the one we expected.
@@ -63,13 +168,9 @@ static int __check_received_frame(tiny_fd_handle_t handle, uint8_t peer, uint8_t
         LOG(TINY_LOG_WRN, "[%p] Out of order I-Frame N(s)=%d\n", handle, ns);
         if ( !handle->peers[peer].sent_reject )
         {
-            tiny_frame_header_t frame = {
-                .address = __peer_to_address_field( handle, peer ) | HDLC_CR_BIT,
-                .control = HDLC_S_FRAME_BITS | HDLC_S_FRAME_TYPE_REJ |
-                    (__i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control) << 5),
-            };
             handle->peers[peer].sent_reject = 1;
-            __put_u_s_frame_to_tx_queue(handle, TINY_FD_QUEUE_S_FRAME, &frame, sizeof(tiny_frame_header_t));
+            __put_s_frame_to_tx_queue(handle, __peer_to_address_field( handle, peer ) | HDLC_CR_BIT, HDLC_S_FRAME_TYPE_REJ,
+                                      __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control), false);
         }
         result = TINY_ERR_FAILED;
     }
@@ -78,39 +179,167 @@ static int __check_received_frame(tiny_fd_handle_t handle, uint8_t peer, uint8_t
 
 ///////////////////////////////////////////////////////////////////////////////
 
+static bool __ack_is_due(tiny_fd_handle_t handle, uint8_t peer)
+{
+    // Number of received I-frames, which N(R) was not sent back yet
+    uint8_t pending = (__i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control) -
+                       handle->peers[peer].sent_nr) & __seq_mask( handle );
+    return !handle->ack_delay || pending >= handle->ack_frames;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void __reassemble_message(tiny_fd_handle_t handle, uint8_t peer, const uint8_t *data, int len)
+{
+    tiny_fd_rx_message_t *message = &__rx_messages( handle )[peer];
+    if ( len < FD_MESSAGE_HEADER_SIZE )
+    {
+        LOG(TINY_LOG_ERR, "[%p] I-Frame without message header\n", handle);
+        return;
+    }
+    uint8_t header = data[0];
+    data += FD_MESSAGE_HEADER_SIZE;
+    len -= FD_MESSAGE_HEADER_SIZE;
+    if ( header & FD_MESSAGE_FIRST_FRAGMENT )
+    {
+        if ( message->active )
+        {
+            LOG(TINY_LOG_WRN, "[%p] Incomplete message is dropped\n", handle);
+        }
+        message->active = 1;
+        message->overflow = 0;
+        message->len = 0;
+    }
+    else if ( !message->active )
+    {
+        // The beginning of the message was lost on reconnect
+        return;
+    }
+    if ( message->overflow || message->len + len > message->size )
+    {
+        message->overflow = 1;
+    }
+    else
+    {
+        memcpy( message->data + message->len, data, len );
+        message->len += len;
+    }
+    if ( header & FD_MESSAGE_MORE_FRAGMENTS )
+    {
+        return;
+    }
+    message->active = 0;
+    if ( message->overflow )
+    {
+        LOG(TINY_LOG_ERR, "[%p] Message is larger than %i bytes, dropped\n", handle, message->size);
+        return;
+    }
+    tiny_mutex_unlock(&handle->frames.mutex);
+    handle->on_read_cb(handle->user_data,
+                       __is_primary_station( handle ) ? (__peer_to_address_field( handle, peer ) >> 2) : TINY_FD_PRIMARY_ADDR,
+                       message->data, message->len);
+    tiny_mutex_lock(&handle->frames.mutex);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void __deliver_i_frame(tiny_fd_handle_t handle, uint8_t peer, uint8_t *data, int len)
+{
+    if ( handle->messages )
+    {
+        int header_size = __frame_header_size( handle, data );
+        __reassemble_message(handle, peer, data + header_size, len - header_size);
+    }
+    else if ( handle->on_read_cb )
+    {
+        int header_size = __frame_header_size( handle, data );
+        tiny_mutex_unlock(&handle->frames.mutex);
+        handle->on_read_cb(handle->user_data,
+                           __is_primary_station( handle ) ? (__peer_to_address_field( handle, peer ) >> 2) : TINY_FD_PRIMARY_ADDR,
+                           data + header_size, len - header_size);
+        tiny_mutex_lock(&handle->frames.mutex);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void __deliver_reordered_frames(tiny_fd_handle_t handle, uint8_t peer)
+{
+    tiny_fd_rx_frame_t *frame;
+    while ( (frame = __find_reordered_frame(handle, peer,
+                         __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control))) != NULL )
+    {
+        uint8_t *data = frame->data;
+        int len = frame->len;
+        frame->data = NULL;
+        // Slot is released before the callback, so the user can hold it with tiny_fd_rx_hold()
+        hdlc_ll_rx_release( handle->_hdlc, data );
+        __i_queue_control_move_to_next_frame_to_receive(&handle->peers[peer].i_queue_control);
+        __deliver_i_frame(handle, peer, data, len);
+    }
+    if ( __has_reordered_frames(handle, peer) )
+    {
+        // There is one more gap: request next missing frame
+        handle->peers[peer].sent_reject = 1;
+        __put_s_frame_to_tx_queue(handle, __peer_to_address_field( handle, peer ) | HDLC_CR_BIT, HDLC_S_FRAME_TYPE_SREJ,
+                                  __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control), false);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 static int __on_i_frame_read(tiny_fd_handle_t handle, uint8_t peer, void *data, int len)
 {
-    uint8_t control = ((uint8_t *)data)[1];
-    uint8_t nr = control >> 5;
-    uint8_t ns = (control >> 1) & 0x07;
+    uint8_t nr = __frame_nr( handle, (uint8_t *)data );
+    uint8_t ns = __frame_ns( handle, (uint8_t *)data );
+    // In ABM mode P bit of I-frame is a checkpoint, which requires immediate answer
+    bool poll = handle->mode == TINY_FD_MODE_ABM && __frame_pf( handle, (uint8_t *)data );
     LOG(TINY_LOG_INFO, "[%p] Receiving I-Frame N(R-sender awaits)=%02X,N(S-seq received)=%02X with address [%02X]\n", handle, nr, ns, ((uint8_t *)data)[0]);
-    int result = __check_received_frame(handle, peer, ns);
+    if ( handle->_hdlc->rx_hold_mask && !hdlc_ll_rx_can_hold( handle->_hdlc ) )
+    {
+        // All RX slots are on loan: withhold acknowledge, the frame is requested again by REJ on release.
+        // sent_reject prevents REJ for the next out of order frames meanwhile.
+        LOG(TINY_LOG_WRN, "[%p] All RX slots are on loan, dropping I-Frame N(s)=%d\n", handle, ns);
+        handle->peers[peer].rx_withheld = 1;
+        handle->peers[peer].sent_reject = 1;
+        __confirm_sent_frames(handle, peer, nr);
+        if ( poll )
+        {
+            __put_s_frame_to_tx_queue(handle, __peer_to_address_field( handle, peer ), HDLC_S_FRAME_TYPE_RNR,
+                                      __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control), true);
+        }
+        return TINY_ERR_BUSY;
+    }
+    int result = __check_received_frame(handle, peer, ns, (uint8_t *)data, len);
     // Confirm all previously sent frames up to received N(R)
     __confirm_sent_frames(handle, peer, nr);
     // Provide data to user only if we expect this frame
     if ( result == TINY_SUCCESS )
     {
-        if ( handle->on_read_cb )
+        __deliver_i_frame(handle, peer, (uint8_t *)data, len);
+        if ( handle->rx_reorder_count )
         {
-            tiny_mutex_unlock(&handle->frames.mutex);
-            handle->on_read_cb(handle->user_data,
-                               __is_primary_station( handle ) ? (__peer_to_address_field( handle, peer ) >> 2) : TINY_FD_PRIMARY_ADDR,
-                               (uint8_t *)data + 2, len - 2);
-            tiny_mutex_lock(&handle->frames.mutex);
+            __deliver_reordered_frames(handle, peer);
         }
         // Decide whenever we need to send RR after user callback
         // Check if we need to send confirmations separately. If we have something to send, just skip RR S-frame.
-        // Also at this point, since we received expected frame, sent_reject will be cleared to 0.
-        if ( __all_frames_are_sent(&handle->peers[peer].i_queue_control) && handle->peers[peer].sent_nr != __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control) )
+        // Also at this point, since we received expected frame, sent_reject is cleared to 0, unless
+        // SREJ for the next gap is already queued: it confirms received frames as well.
+        // If the user took the last RX slot in the callback, RNR is queued already, and it confirms frames too.
+        if ( __all_frames_are_sent(&handle->peers[peer].i_queue_control) && !handle->peers[peer].sent_reject &&
+             !handle->local_busy && !poll && handle->peers[peer].sent_nr != __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control) &&
+             __ack_is_due(handle, peer) )
         {
-            tiny_frame_header_t frame = {
-                .address = __peer_to_address_field( handle, peer ),
-                .control = HDLC_S_FRAME_BITS | HDLC_S_FRAME_TYPE_RR |
-                    (__i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control) << 5),
-            };
-            __put_u_s_frame_to_tx_queue(handle, TINY_FD_QUEUE_S_FRAME, &frame, 2);
+            __put_s_frame_to_tx_queue(handle, __peer_to_address_field( handle, peer ), HDLC_S_FRAME_TYPE_RR,
+                                      __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control), false);
         }
     }
+    if ( poll )
+    {
+        // Answer checkpoint immediately, bypassing delayed acknowledgement
+        __put_s_frame_to_tx_queue(handle, __peer_to_address_field( handle, peer ), __rx_ready_frame_type( handle ),
+                                  __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control), true);
+    }
     return result;
 }
 
@@ -120,15 +349,29 @@ static int __on_s_frame_read(tiny_fd_handle_t handle, uint8_t peer, void *data,
 {
     uint8_t address = ((uint8_t *)data)[0];
     uint8_t control = ((uint8_t *)data)[1];
-    uint8_t nr = control >> 5;
+    uint8_t nr = __frame_nr( handle, (uint8_t *)data );
     int result = TINY_ERR_FAILED;
     LOG(TINY_LOG_INFO, "[%p] Receiving S-Frame N(R)=%02X, type=%s with address [%02X]\n", handle, nr,
         ((control >> 2) & 0x03) == 0x00 ? "RR" : ((control >> 2) & 0x03) == 0x01 ? "RNR" : ((control >> 2) & 0x03) == 0x02 ? "REJ" : "SREJ", ((uint8_t *)data)[0]);
+    if ( (control & HDLC_S_FRAME_TYPE_MASK) != HDLC_S_FRAME_TYPE_RNR && handle->peers[peer].remote_busy )
+    {
+        // RR, REJ and SREJ clear remote busy condition
+        LOG(TINY_LOG_INFO, "[%p] Peer is ready, resuming I-frame transmission\n", handle);
+        handle->peers[peer].remote_busy = 0;
+        tiny_events_set(&handle->events, FD_EVENT_TX_DATA_AVAILABLE);
+    }
     if ( (control & HDLC_S_FRAME_TYPE_MASK) == HDLC_S_FRAME_TYPE_REJ )
     {
         // Confirm all previously sent frames up to received N(R)
         __confirm_sent_frames(handle, peer, nr);
+        const bool polled = handle->peers[peer].checkpoint_ns != FD_NO_CHECKPOINT;
         __resend_all_unconfirmed_frames(handle, peer, control, nr);
+        if ( polled )
+        {
+            // The peer still answers P bit of rewound frames. The answer doesn't tell anything about
+            // retransmitted frames, and no new checkpoint is set until it arrives.
+            handle->peers[peer].checkpoint_ns = FD_STALE_CHECKPOINT;
+        }
     }
     else if ( (control & HDLC_S_FRAME_TYPE_MASK) == HDLC_S_FRAME_TYPE_RR )
     {
@@ -136,16 +379,12 @@ static int __on_s_frame_read(tiny_fd_handle_t handle, uint8_t peer, void *data,
         __confirm_sent_frames(handle, peer, nr);
         if ( address & HDLC_CR_BIT )
         {
-            // Send answer if we don't have frames to send
-            if ( __all_frames_are_sent(&handle->peers[peer].i_queue_control) )
+            // Send answer if we don't have frames to send, or cannot accept frames
+            if ( __all_frames_are_sent(&handle->peers[peer].i_queue_control) || handle->local_busy )
             {
-                tiny_frame_header_t frame = {
-                    .address = __peer_to_address_field( handle, peer ),
-                    .control = HDLC_S_FRAME_BITS | HDLC_S_FRAME_TYPE_RR |
-                        (control & HDLC_P_BIT) |
-                        (__i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control) << 5),
-                };
-                __put_u_s_frame_to_tx_queue(handle, TINY_FD_QUEUE_S_FRAME, &frame, 2);
+                __put_s_frame_to_tx_queue(handle, __peer_to_address_field( handle, peer ), __rx_ready_frame_type( handle ),
+                                          __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control),
+                                          __frame_pf( handle, (uint8_t *)data ));
             }
         }
     }
@@ -153,15 +392,43 @@ static int __on_s_frame_read(tiny_fd_handle_t handle, uint8_t peer, void *data,
     {
         // Confirm all previously sent frames up to received N(R), but peer is busy — do not send more
         __confirm_sent_frames(handle, peer, nr);
-        LOG(TINY_LOG_WRN, "[%p] Peer signalled RNR (busy), pausing I-frame transmission\n", handle);
+        if ( !handle->peers[peer].remote_busy )
+        {
+            LOG(TINY_LOG_WRN, "[%p] Peer signalled RNR (busy), pausing I-frame transmission\n", handle);
+        }
+        handle->peers[peer].remote_busy = 1;
+        if ( (address & HDLC_CR_BIT) && __frame_pf( handle, (uint8_t *)data ) )
+        {
+            // RNR command with poll bit requires an answer
+            __put_s_frame_to_tx_queue(handle, __peer_to_address_field( handle, peer ), __rx_ready_frame_type( handle ),
+                                      __i_queue_control_get_next_frame_to_receive(&handle->peers[peer].i_queue_control), true);
+        }
     }
     else if ( (control & HDLC_S_FRAME_TYPE_MASK) == HDLC_S_FRAME_TYPE_SREJ )
     {
         // SREJ: confirm frames up to N(R), retransmit only frame N(R)
         __confirm_sent_frames(handle, peer, nr);
         LOG(TINY_LOG_INFO, "[%p] SREJ received for frame N(R)=%d, scheduling selective retransmit\n", handle, nr);
-        handle->peers[peer].srej_req_mask |= (1 << nr);
-        tiny_events_set(&handle->events, FD_EVENT_TX_DATA_AVAILABLE);
+        handle->peers[peer].checkpoint_ns = FD_NO_CHECKPOINT;
+        if ( __request_i_frame_retransmit(handle, peer, nr) )
+        {
+            __cancel_rtt_measurement(handle, peer);
+            tiny_events_set(&handle->events, FD_EVENT_TX_DATA_AVAILABLE);
+        }
+    }
+    if ( handle->peers[peer].checkpoint_ns != FD_NO_CHECKPOINT && !(address & HDLC_CR_BIT) && __frame_pf( handle, (uint8_t *)data ) )
+    {
+        // Answer to checkpoint: the peer has received everything before N(R), so frames
+        // starting from N(R) up to the checkpoint are lost. Retransmit them without waiting for timeout.
+        const uint8_t checkpoint_ns = handle->peers[peer].checkpoint_ns;
+        handle->peers[peer].checkpoint_ns = FD_NO_CHECKPOINT;
+        if ( checkpoint_ns != FD_STALE_CHECKPOINT && (control & HDLC_S_FRAME_TYPE_MASK) == HDLC_S_FRAME_TYPE_RR && nr != checkpoint_ns &&
+             __i_queue_control_get_next_frame_to_confirm(&handle->peers[peer].i_queue_control) !=
+                 __i_queue_control_get_next_frame_to_send(&handle->peers[peer].i_queue_control) )
+        {
+            LOG(TINY_LOG_WRN, "[%p] Checkpoint N(R)=%02X, retransmitting lost frames\n", handle, nr);
+            __resend_all_unconfirmed_frames(handle, peer, control, nr);
+        }
     }
     return result;
 }
@@ -174,10 +441,11 @@ static int __on_u_frame_read(tiny_fd_handle_t handle, uint8_t peer, void *data,
     uint8_t type = control & HDLC_U_FRAME_TYPE_MASK;
     int result = TINY_ERR_FAILED;
     LOG(TINY_LOG_INFO, "[%p] Receiving U-Frame type=%02X with address [%02X]\n", handle, type, ((uint8_t *)data)[0]);
-    // In disconnected state, only accept connection setup (SABM/SNRM) and connectionless (UI) frames.
-    // Respond with DM to commands; silently ignore responses.
+    // In disconnected state, only accept connection setup (SABM/SNRM, or SABME/SNRME in extended mode)
+    // and connectionless (UI) frames. Respond with DM to commands; silently ignore responses.
+    // So, the station answers with DM, if remote side requests different sequence numbering mode.
     if ( handle->peers[peer].state == TINY_FD_STATE_DISCONNECTED &&
-         type != HDLC_U_FRAME_TYPE_SABM && type != HDLC_U_FRAME_TYPE_SNRM && type != HDLC_U_FRAME_TYPE_UI )
+         !__is_set_mode_frame_type( handle, type ) && type != HDLC_U_FRAME_TYPE_UI )
     {
         LOG(TINY_LOG_WRN, "[%p] Ignoring U-frame type=%02X in disconnected state\n", handle, type);
         if ( ((uint8_t *)data)[0] & HDLC_CR_BIT )
@@ -190,7 +458,7 @@ static int __on_u_frame_read(tiny_fd_handle_t handle, uint8_t peer, void *data,
         }
         return result;
     }
-    if ( type == HDLC_U_FRAME_TYPE_SABM || type == HDLC_U_FRAME_TYPE_SNRM )
+    if ( __is_set_mode_frame_type( handle, type ) )
     {
         tiny_frame_header_t frame = {
             .address = __peer_to_address_field( handle, peer ),
@@ -217,9 +485,15 @@ static int __on_u_frame_read(tiny_fd_handle_t handle, uint8_t peer, void *data,
         // RSET resets sequence numbers and expects UA response
         LOG(TINY_LOG_WRN, "[%p] RSET received, resetting sequence numbers\n", handle);
         __reset_i_queue_control(&handle->peers[peer].i_queue_control);
+        __drop_reordered_frames(handle, peer);
+        __drop_partial_message(handle, peer);
+        // Queued frames are numbered with old sequence numbers, they cannot be sent anymore
+        __reset_i_frames( handle, peer );
         handle->peers[peer].sent_nr = 0;
         handle->peers[peer].sent_reject = 0;
-        handle->peers[peer].srej_req_mask = 0;
+        handle->peers[peer].srej_pending = 0;
+        handle->peers[peer].remote_busy = 0;
+        handle->peers[peer].checkpoint_ns = FD_NO_CHECKPOINT;
         tiny_frame_header_t frame = {
             .address = __peer_to_address_field( handle, peer ),
             .control = HDLC_U_FRAME_TYPE_UA | HDLC_U_FRAME_BITS,
@@ -228,7 +502,7 @@ static int __on_u_frame_read(tiny_fd_handle_t handle, uint8_t peer, void *data,
     }
     else if ( type == HDLC_U_FRAME_TYPE_FRMR )
     {
-        // FRMR indicates protocol error on remote side — initiate link reset via SABM/SNRM
+        // FRMR indicates protocol error on remote side — initiate link reset via SABM/SNRM (SABME/SNRME)
         LOG(TINY_LOG_ERR, "[%p] FRMR received, initiating link reset\n", handle);
         if ( handle->peers[peer].state != TINY_FD_STATE_DISCONNECTED )
         {
@@ -236,7 +510,7 @@ static int __on_u_frame_read(tiny_fd_handle_t handle, uint8_t peer, void *data,
         }
         tiny_frame_header_t sabm_frame = {
             .address = __peer_to_address_field( handle, peer ) | HDLC_CR_BIT,
-            .control = (handle->mode == TINY_FD_MODE_NRM ? HDLC_U_FRAME_TYPE_SNRM : HDLC_U_FRAME_TYPE_SABM) | HDLC_U_FRAME_BITS,
+            .control = __set_mode_frame_type( handle ) | HDLC_U_FRAME_BITS,
         };
         __put_u_s_frame_to_tx_queue(handle, TINY_FD_QUEUE_U_FRAME, &sabm_frame, 2);
         handle->peers[peer].state = TINY_FD_STATE_CONNECTING;
@@ -66,6 +66,11 @@ uint8_t __address_field_to_peer(tiny_fd_handle_t handle, uint8_t address)
 uint8_t __switch_to_next_peer(tiny_fd_handle_t handle)
 {
     const uint8_t start_peer = handle->next_peer;
+    if ( handle->peer_quantum && __all_frames_are_sent( &handle->peers[start_peer].i_queue_control ) )
+    {
+        // Idle peer doesn't keep deficit till the next turn
+        handle->peers[start_peer].deficit = 0;
+    }
     do
     {
         if ( ++handle->next_peer >= handle->peers_count )
@@ -77,6 +82,11 @@ uint8_t __switch_to_next_peer(tiny_fd_handle_t handle)
             break;
         }
     } while ( start_peer != handle->next_peer );
+    if ( handle->peer_quantum )
+    {
+        uint16_t *deficit = &handle->peers[ handle->next_peer ].deficit;
+        *deficit = (uint16_t)(*deficit > 0xFFFF - handle->peer_quantum ? 0xFFFF : *deficit + handle->peer_quantum);
+    }
     LOG(TINY_LOG_INFO, "[%p] Switching to peer [%02X]\n", handle, handle->next_peer);
     return start_peer != handle->next_peer;
 }
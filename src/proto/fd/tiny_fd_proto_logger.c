@@ -63,12 +63,12 @@ static tiny_fd_frame_subtype_t __get_frame_subtype(uint8_t control)
 
 ///////////////////////////////////////////////////////////////////////////////
 
-static uint8_t __get_frame_sequence(uint8_t control)
+static uint8_t __get_frame_sequence(tiny_fd_handle_t handle, const uint8_t *data)
 {
-    tiny_fd_frame_type_t type = __get_frame_type(control);
+    tiny_fd_frame_type_t type = __get_frame_type(data[1]);
     switch (type)
     {
-        case TINY_FD_FRAME_TYPE_I: return (control >> 1) & 0x07;
+        case TINY_FD_FRAME_TYPE_I: return __frame_ns(handle, data);
         case TINY_FD_FRAME_TYPE_S:
         case TINY_FD_FRAME_TYPE_U:
         default: return 0;
@@ -77,13 +77,13 @@ static uint8_t __get_frame_sequence(uint8_t control)
 
 ///////////////////////////////////////////////////////////////////////////////
 
-static uint8_t __get_awaiting_sequence(uint8_t control)
+static uint8_t __get_awaiting_sequence(tiny_fd_handle_t handle, const uint8_t *data)
 {
-    tiny_fd_frame_type_t type = __get_frame_type(control);
+    tiny_fd_frame_type_t type = __get_frame_type(data[1]);
     switch (type)
     {
-        case TINY_FD_FRAME_TYPE_I: return control >> 5;
-        case TINY_FD_FRAME_TYPE_S: return control >> 5;
+        case TINY_FD_FRAME_TYPE_I: return __frame_nr(handle, data);
+        case TINY_FD_FRAME_TYPE_S: return __frame_nr(handle, data);
         case TINY_FD_FRAME_TYPE_U:
         default: return 0;
     }
@@ -130,6 +130,8 @@ static const char *__get_frame_subtype_str(uint8_t control)
         case HDLC_U_FRAME_TYPE_RSET: return "RSET";
         case HDLC_U_FRAME_TYPE_SABM: return "SABM";
         case HDLC_U_FRAME_TYPE_SNRM: return "SNRM";
+        case HDLC_U_FRAME_TYPE_SABME: return "SABME";
+        case HDLC_U_FRAME_TYPE_SNRME: return "SNRME";
         case HDLC_U_FRAME_TYPE_DISC: return "DISC";
         case HDLC_U_FRAME_TYPE_UI:   return "  UI";
         default:                     return " UNK";
@@ -143,7 +145,7 @@ void __tiny_fd_log_frame(tiny_fd_handle_t handle,
                        const uint8_t *data,
                        int len)
 {
-    if (handle == NULL || data == NULL || len < 2) {
+    if (handle == NULL || data == NULL || len < 2 || len < __frame_header_size(handle, data)) {
         return;
     }
     if (handle->log_frame_cb) {
@@ -152,15 +154,15 @@ void __tiny_fd_log_frame(tiny_fd_handle_t handle,
                              direction,
                              __get_frame_type(data[1]),
                              __get_frame_subtype(data[1]),
-                             __get_frame_sequence(data[1]),
-                             __get_awaiting_sequence(data[1]), data, len);
+                             __get_frame_sequence(handle, data),
+                             __get_awaiting_sequence(handle, data), data, len);
     }
     FILE_LOG((uintptr_t)handle,
         direction == TINY_FD_FRAME_DIRECTION_IN ? " IN" : "OUT",
         data[0],
         __get_frame_type_str(data[1]),
         __get_frame_subtype_str(data[1]),
-        __get_frame_sequence(data[1]),
-        __get_awaiting_sequence(data[1]));
+        __get_frame_sequence(handle, data),
+        __get_awaiting_sequence(handle, data));
 }
 
@@ -57,19 +57,39 @@ tiny_fd_frame_info_t *__put_u_s_frame_to_tx_queue(tiny_fd_handle_t handle, int t
 
 ///////////////////////////////////////////////////////////////////////////////
 
+tiny_fd_frame_info_t *__put_s_frame_to_tx_queue(tiny_fd_handle_t handle, uint8_t address, uint8_t type, uint8_t nr, bool pf)
+{
+    uint8_t frame[3] = { address, HDLC_S_FRAME_BITS | type, 0 };
+    __frame_set_nr( handle, frame, nr );
+    if ( pf )
+    {
+        __frame_set_pf( handle, frame );
+    }
+    return __put_u_s_frame_to_tx_queue( handle, TINY_FD_QUEUE_S_FRAME, frame, __frame_header_size( handle, frame ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 uint8_t *tiny_fd_get_next_s_u_frame_to_send(tiny_fd_handle_t handle, int *len, uint8_t peer, uint8_t address)
 {
     uint8_t *data = NULL;
     // LOG(TINY_LOG_DEB, "[%p] QUEUE SEARCH: [%02X] [%02X]\n", handle, address, TINY_FD_QUEUE_S_FRAME | TINY_FD_QUEUE_U_FRAME);
-    tiny_fd_frame_info_t *ptr = tiny_fd_queue_get_next( &handle->frames.s_queue, TINY_FD_QUEUE_S_FRAME | TINY_FD_QUEUE_U_FRAME, address, 0 );
+    tiny_fd_frame_info_t *ptr = tiny_fd_queue_get_next( &handle->frames.s_queue, TINY_FD_QUEUE_S_FRAME | TINY_FD_QUEUE_U_FRAME, address );
+    // Service frames always go ahead of UI data frames
+    if ( ptr == NULL )
+    {
+        ptr = tiny_fd_queue_get_next( __get_ui_queue( handle ), TINY_FD_QUEUE_UI_FRAME, address );
+    }
     if ( ptr != NULL )
     {
-        // clear queue only, when send is done, so for now, use pointer data for sending only
+        // clear queue only, when send is done, so for now, use pointer data for sending only.
+        // The frame can wait in hdlc queue, so it must not be selected again until then
+        ptr->type = TINY_FD_QUEUE_SENDING;
         data = (uint8_t *)&ptr->header;
         *len = ptr->len + sizeof(tiny_frame_header_t);
         if ( (data[1] & HDLC_S_FRAME_MASK) == HDLC_S_FRAME_BITS )
         {
-            handle->peers[peer].sent_nr = ptr->header.control >> 5;
+            handle->peers[peer].sent_nr = __frame_nr( handle, data );
         }
 #if TINY_FD_DEBUG
         if ( (data[1] & HDLC_U_FRAME_MASK) == HDLC_U_FRAME_BITS )
@@ -79,7 +99,7 @@ uint8_t *tiny_fd_get_next_s_u_frame_to_send(tiny_fd_handle_t handle, int *len, u
         }
         else if ( (data[1] & HDLC_S_FRAME_MASK) == HDLC_S_FRAME_BITS )
         {
-            LOG(TINY_LOG_INFO, "[%p] Sending S-Frame N(R)=%02X, type=%s with address [%02X] to %s\n", handle, data[1] >> 5,
+            LOG(TINY_LOG_INFO, "[%p] Sending S-Frame N(R)=%02X, type=%s with address [%02X] to %s\n", handle, __frame_nr( handle, data ),
                 ((data[1] >> 2) & 0x03) == 0x00 ? "RR" : "REJ", data[0],  __is_primary_station( handle ) ? "secondary" : "primary");
         }
 #endif
@@ -88,3 +108,8 @@ uint8_t *tiny_fd_get_next_s_u_frame_to_send(tiny_fd_handle_t handle, int *len, u
 }
 
 ///////////////////////////////////////////////////////////////////////////////
+
+tiny_fd_queue_t *__get_ui_queue(tiny_fd_handle_t handle)
+{
+    return handle->frames.ui_queue;
+}
@@ -30,7 +30,9 @@
 
 #include "tiny_fd.h"
 #include "tiny_fd_frames_int.h"
+#include "tiny_fd_frames_queue_int.h"
 #include <stdint.h>
+#include <stdbool.h>
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -38,6 +40,14 @@ tiny_fd_frame_info_t *__put_u_s_frame_to_tx_queue(tiny_fd_handle_t handle, int t
 
 ///////////////////////////////////////////////////////////////////////////////
 
+tiny_fd_frame_info_t *__put_s_frame_to_tx_queue(tiny_fd_handle_t handle, uint8_t address, uint8_t type, uint8_t nr, bool pf);
+
+///////////////////////////////////////////////////////////////////////////////
+
 uint8_t* tiny_fd_get_next_s_u_frame_to_send(tiny_fd_handle_t handle, int *len, uint8_t peer, uint8_t address);
 
 ///////////////////////////////////////////////////////////////////////////////
+
+tiny_fd_queue_t *__get_ui_queue(tiny_fd_handle_t handle);
+
+///////////////////////////////////////////////////////////////////////////////
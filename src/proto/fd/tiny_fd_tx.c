@@ -50,8 +50,7 @@ static bool __on_frame_confirmed(void *ctx, uint8_t nr)
     tiny_fd_handle_t handle = c->handle;
     uint8_t peer = c->peer;
         
-    uint8_t address = __peer_to_address_field( handle, peer );
-    tiny_fd_frame_info_t *slot = tiny_fd_queue_get_next( &handle->frames.i_queue, TINY_FD_QUEUE_I_FRAME, address, nr );
+    tiny_fd_frame_info_t *slot = __get_i_frame_from_tx_queue( handle, peer, nr );
     if ( slot != NULL )
     {
         if ( handle->on_send_cb )
@@ -59,15 +58,12 @@ static bool __on_frame_confirmed(void *ctx, uint8_t nr)
             tiny_mutex_unlock(&handle->frames.mutex);
             handle->on_send_cb(handle->user_data,
                                 __is_primary_station( handle ) ? (__peer_to_address_field( handle, peer ) >> 2) : TINY_FD_PRIMARY_ADDR,
-                                &slot->payload[0], slot->len);
+                                &slot->payload[handle->ext_control], slot->len - handle->ext_control);
             tiny_mutex_lock(&handle->frames.mutex);
         }
-        tiny_fd_queue_free( &handle->frames.i_queue, slot );
-        if ( tiny_fd_queue_has_free_slots( &handle->frames.i_queue ) )
-        {
-            // Unblock tx queue to allow application to put new frames for sending
-            tiny_events_set(&handle->events, FD_EVENT_QUEUE_HAS_FREE_SLOTS);
-        }
+        __free_i_frame_from_tx_queue( handle, peer, nr );
+        // Unblock tx queue to allow application to put new frames for sending
+        __update_i_queue_free_slots_events( handle );
         handle->peers[peer].retries = handle->retries;
         return true;
     }
@@ -80,13 +76,110 @@ static bool __on_frame_confirmed(void *ctx, uint8_t nr)
 
 ///////////////////////////////////////////////////////////////////////////////
 
+static uint16_t __clamp_rto(tiny_fd_handle_t handle, uint32_t rto)
+{
+    if ( rto < handle->rto_min )
+    {
+        return handle->rto_min;
+    }
+    return rto > handle->rto_max ? handle->rto_max : (uint16_t)rto;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void __set_rtt_state(tiny_fd_handle_t handle, uint8_t peer, uint8_t state)
+{
+    // FD_RTT_SAMPLED flag survives measurement state changes, and is cleared only by __reset_rto()
+    handle->peers[peer].rtt_state = (handle->peers[peer].rtt_state & FD_RTT_SAMPLED) | state;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void __update_rto(tiny_fd_handle_t handle, uint8_t peer, uint32_t rtt)
+{
+    tiny_fd_peer_info_t *info = &handle->peers[peer];
+    rtt = rtt > 0xFFFF ? 0xFFFF : rtt;
+    // RFC 6298: alpha = 1/8, beta = 1/4, K = 4, clock granularity is 1 ms
+    if ( !(info->rtt_state & FD_RTT_SAMPLED) )
+    {
+        info->rtt_state |= FD_RTT_SAMPLED;
+        info->srtt = (uint16_t)rtt;
+        info->rttvar = (uint16_t)(rtt / 2);
+    }
+    else
+    {
+        uint32_t delta = rtt > info->srtt ? rtt - info->srtt : info->srtt - rtt;
+        info->rttvar = (uint16_t)((3 * (uint32_t)info->rttvar + delta) / 4);
+        info->srtt = (uint16_t)((7 * (uint32_t)info->srtt + rtt) / 8);
+    }
+    info->rto = __clamp_rto(handle, info->srtt + (info->rttvar ? 4 * (uint32_t)info->rttvar : 1));
+    LOG(TINY_LOG_DEB, "[%p] RTT %" PRIu32 " ms, SRTT %u ms, RTO %u ms\n", handle, rtt, info->srtt, info->rto);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void __reset_rto(tiny_fd_handle_t handle, uint8_t peer)
+{
+    handle->peers[peer].srtt = 0;
+    handle->peers[peer].rttvar = 0;
+    handle->peers[peer].rtt_state = FD_RTT_IDLE;
+    handle->peers[peer].rto = handle->rto_max ? __clamp_rto(handle, handle->retry_timeout) : handle->retry_timeout;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void __start_rtt_measurement(tiny_fd_handle_t handle, uint8_t peer)
+{
+    // Round trip time is measured from last_sent_i_ts, till the last sent frame is confirmed
+    if ( handle->rto_max && (handle->peers[peer].rtt_state & FD_RTT_STATE_MASK) == FD_RTT_IDLE )
+    {
+        __set_rtt_state(handle, peer, FD_RTT_TIMING);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void __cancel_rtt_measurement(tiny_fd_handle_t handle, uint8_t peer)
+{
+    // Acknowledgement of retransmitted frame is ambiguous, it cannot be used to measure round trip time
+    if ( handle->rto_max )
+    {
+        __set_rtt_state(handle, peer, FD_RTT_HOLDOFF);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void __backoff_rto(tiny_fd_handle_t handle, uint8_t peer)
+{
+    if ( handle->rto_max )
+    {
+        handle->peers[peer].rto = __clamp_rto(handle, 2 * (uint32_t)handle->peers[peer].rto);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void __confirm_sent_frames(tiny_fd_handle_t handle, uint8_t peer, uint8_t nr)
 {
     on_confirmed_ctx_t ctx = {
         .handle = handle,
         .peer = peer
     };
-    if (__i_queue_control_confirm_sent_frames(&handle->peers[peer].i_queue_control, nr, __on_frame_confirmed, &ctx))
+    i_queue_control_t *control = &handle->peers[peer].i_queue_control;
+    // Queued frames, which are not sent yet, do not matter for round trip time
+    bool had_unconfirmed = __i_queue_control_get_next_frame_to_confirm( control ) != __i_queue_control_get_next_frame_to_send( control );
+    __i_queue_control_confirm_sent_frames(control, nr, __on_frame_confirmed, &ctx);
+    if ( had_unconfirmed && __i_queue_control_get_next_frame_to_confirm( control ) == __i_queue_control_get_next_frame_to_send( control ) )
+    {
+        // The last sent frame is confirmed
+        if ( (handle->peers[peer].rtt_state & FD_RTT_STATE_MASK) == FD_RTT_TIMING )
+        {
+            __update_rto(handle, peer, (uint32_t)(tiny_millis() - handle->peers[peer].last_sent_i_ts));
+        }
+        __set_rtt_state(handle, peer, FD_RTT_IDLE);
+    }
+    if ( __peer_can_accept_i_frames( handle, peer ) )
     {
         // Unblock specific peer to accept new frames for sending
         tiny_events_set(&handle->peers[peer].events, FD_EVENT_CAN_ACCEPT_I_FRAMES);
@@ -95,8 +188,38 @@ void __confirm_sent_frames(tiny_fd_handle_t handle, uint8_t peer, uint8_t nr)
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void __purge_tx_queue(tiny_fd_handle_t handle)
+{
+    // Service and UI frames go back to their queues, I-frames stay in I-queue until they are sent again
+    handle->tx_purge = 1;
+    hdlc_ll_tx_purge( handle->_hdlc );
+    handle->tx_purge = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void __reset_i_frames(tiny_fd_handle_t handle, uint8_t peer)
+{
+    const uint8_t address = __peer_to_address_field( handle, peer );
+    __purge_tx_queue( handle );
+    const uint8_t *sending = handle->_hdlc->tx.origin_data;
+    if ( sending != NULL && (sending[1] & HDLC_I_FRAME_MASK) == HDLC_I_FRAME_BITS && (sending[0] & 0xFC) == (address & 0xFC) )
+    {
+        // hdlc level still reads the frame, so the slot is freed by on_frame_send()
+        tiny_fd_queue_get_by_header( sending )->type = TINY_FD_QUEUE_SENDING;
+    }
+    tiny_fd_queue_reset_for( &handle->frames.i_queue, address );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void __resend_all_unconfirmed_frames(tiny_fd_handle_t handle, uint8_t peer, uint8_t control, uint8_t nr)
 {
+    // Frames, waiting in hdlc TX queue, would go to the channel ahead of retransmitted ones
+    __purge_tx_queue(handle);
+    __cancel_rtt_measurement(handle, peer);
+    // Retransmitted frames are checked by new checkpoint
+    handle->peers[peer].checkpoint_ns = FD_NO_CHECKPOINT;
     // First, we need to check if that is possible. Maybe remote side is not in sync
     while ( __i_queue_control_get_next_frame_to_send(&handle->peers[peer].i_queue_control) != nr )
     {
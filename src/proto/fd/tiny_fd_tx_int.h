@@ -34,4 +34,10 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 void __confirm_sent_frames(tiny_fd_handle_t handle, uint8_t peer, uint8_t nr);
+void __purge_tx_queue(tiny_fd_handle_t handle);
+void __reset_i_frames(tiny_fd_handle_t handle, uint8_t peer);
 void __resend_all_unconfirmed_frames(tiny_fd_handle_t handle, uint8_t peer, uint8_t control, uint8_t nr);
+void __reset_rto(tiny_fd_handle_t handle, uint8_t peer);
+void __start_rtt_measurement(tiny_fd_handle_t handle, uint8_t peer);
+void __cancel_rtt_measurement(tiny_fd_handle_t handle, uint8_t peer);
+void __backoff_rto(tiny_fd_handle_t handle, uint8_t peer);
@@ -128,6 +128,8 @@ static void hdlc_send_terminate(hdlc_handle_t handle)
     LOG(TINY_LOG_INFO, "[HDLC:%p] hdlc_send_terminate HDLC send failed on timeout\n", handle);
     tiny_events_clear(&handle->events, TX_DATA_READY_BIT);
     hdlc_ll_reset(handle->handle, HDLC_LL_RESET_TX_ONLY);
+    // Terminated frame is returned via on_frame_send(), but it is not sent
+    tiny_events_clear(&handle->events, TX_DATA_SENT_BIT);
     tiny_events_set(&handle->events, TX_ACCEPT_BIT);
 }
 
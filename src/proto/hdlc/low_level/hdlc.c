@@ -28,10 +28,12 @@
 
 #include "hdlc.h"
 #include "hdlc_int.h"
+#include "hdlc_scan_int.h"
 #include "proto/crc/tiny_crc.h"
 #include "hal/tiny_debug.h"
 
 #include <stddef.h>
+#include <string.h>
 
 #ifndef TINY_HDLC_DEBUG
 #define TINY_HDLC_DEBUG 0
@@ -44,10 +46,20 @@
 #endif
 
 #define FLAG_SEQUENCE 0x7E
+#define COBS_DELIMITER 0x00
+#define COBS_MAX_BLOCK 254
+#define LENGTH_MARKER 0x7E
+#define LENGTH_HEADER_SIZE 3
 #define FILL_BYTE 0xFF
 #define TINY_ESCAPE_CHAR 0x7D
 #define TINY_ESCAPE_BIT 0x20
 
+// Maximum size of encoded frame: 2 flags and every payload and crc byte escaped
+#define HDLC_LL_MAX_FRAME_SIZE(len, crc) (2 + 2 * ((len) + (uint8_t)(crc) / 8))
+
+// TX queue is located in user buffer right after hdlc_ll_data_t
+#define HDLC_LL_TX_QUEUE(handle) ((hdlc_ll_tx_frame_t *)((handle) + 1))
+
 enum
 {
     TX_ACCEPT_BIT = 0x01,
@@ -57,6 +69,7 @@ enum
 };
 
 static int hdlc_ll_read_start(hdlc_ll_handle_t handle, const uint8_t *data, int len);
+static int hdlc_ll_read_idle(hdlc_ll_handle_t handle, const uint8_t *data, int len);
 static int hdlc_ll_read_data(hdlc_ll_handle_t handle, const uint8_t *data, int len);
 static int hdlc_ll_read_end(hdlc_ll_handle_t handle, const uint8_t *data, int len);
 
@@ -65,6 +78,59 @@ static int hdlc_ll_send_data(hdlc_ll_handle_t handle);
 static int hdlc_ll_send_tx_internal(hdlc_ll_handle_t handle, const void *data, int len);
 static int hdlc_ll_send_crc(hdlc_ll_handle_t handle);
 static int hdlc_ll_send_end(hdlc_ll_handle_t handle);
+static void hdlc_ll_send_frame_block(hdlc_ll_handle_t handle);
+
+static int hdlc_ll_cobs_read_start(hdlc_ll_handle_t handle, const uint8_t *data, int len);
+static int hdlc_ll_cobs_read_idle(hdlc_ll_handle_t handle, const uint8_t *data, int len);
+static int hdlc_ll_cobs_read_data(hdlc_ll_handle_t handle, const uint8_t *data, int len);
+static int hdlc_ll_cobs_send_start(hdlc_ll_handle_t handle);
+static int hdlc_ll_cobs_send_code(hdlc_ll_handle_t handle);
+static int hdlc_ll_cobs_send_block(hdlc_ll_handle_t handle);
+static int hdlc_ll_cobs_send_end(hdlc_ll_handle_t handle);
+
+static int hdlc_ll_length_read_start(hdlc_ll_handle_t handle, const uint8_t *data, int len);
+static int hdlc_ll_length_read_header(hdlc_ll_handle_t handle, const uint8_t *data, int len);
+static int hdlc_ll_length_read_data(hdlc_ll_handle_t handle, const uint8_t *data, int len);
+static int hdlc_ll_length_send_start(hdlc_ll_handle_t handle);
+static int hdlc_ll_length_send_data(hdlc_ll_handle_t handle);
+static int hdlc_ll_length_send_crc(hdlc_ll_handle_t handle);
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static void hdlc_ll_rx_hunt(hdlc_ll_handle_t handle)
+{
+    switch ( handle->framing )
+    {
+        case HDLC_FRAMING_COBS: handle->rx.state = hdlc_ll_cobs_read_start; break;
+        case HDLC_FRAMING_LENGTH: handle->rx.state = hdlc_ll_length_read_start; break;
+        default: handle->rx.state = hdlc_ll_read_start; break;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static void hdlc_ll_rx_next_frame(hdlc_ll_handle_t handle)
+{
+    switch ( handle->framing )
+    {
+        // Delimiter is shared between COBS frames, so next frame starts right after it
+        case HDLC_FRAMING_COBS: handle->rx.state = hdlc_ll_cobs_read_idle; break;
+        case HDLC_FRAMING_LENGTH: handle->rx.state = hdlc_ll_length_read_start; break;
+        default: handle->rx.state = handle->shared_flag ? hdlc_ll_read_idle : hdlc_ll_read_start; break;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static void hdlc_ll_tx_next_frame(hdlc_ll_handle_t handle)
+{
+    switch ( handle->framing )
+    {
+        case HDLC_FRAMING_COBS: handle->tx.state = hdlc_ll_cobs_send_start; break;
+        case HDLC_FRAMING_LENGTH: handle->tx.state = hdlc_ll_length_send_start; break;
+        default: handle->tx.state = hdlc_ll_send_start; break;
+    }
+}
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -75,6 +141,12 @@ int hdlc_ll_init(hdlc_ll_handle_t *handle, hdlc_ll_init_t *init)
         LOG(TINY_LOG_ERR, "[HDLC] failed to init hdlc. buf=%p\n", init->buf);
         return TINY_ERR_INVALID_DATA;
     }
+    if ( init->framing != HDLC_FRAMING_HDLC && init->framing != HDLC_FRAMING_COBS &&
+         init->framing != HDLC_FRAMING_LENGTH )
+    {
+        LOG(TINY_LOG_ERR, "[HDLC] failed to init hdlc. unknown framing %i\n", init->framing);
+        return TINY_ERR_INVALID_DATA;
+    }
     *handle = NULL;
     // Aligning provided buffer for the system
     uint8_t *aligned_buf = (uint8_t *)( ((uintptr_t)init->buf + TINY_ALIGN_STRUCT_VALUE - 1) & (~(TINY_ALIGN_STRUCT_VALUE - 1)) );
@@ -86,14 +158,29 @@ int hdlc_ll_init(hdlc_ll_handle_t *handle, hdlc_ll_init_t *init)
             (int)(sizeof(hdlc_ll_data_t) + TINY_ALIGN_STRUCT_VALUE - 1));
         return TINY_ERR_OUT_OF_MEMORY;
     }
+    int queue_size = HDLC_TX_QUEUE_BUF_SIZE(init->tx_queue_size);
+    if ( buf_size < (int)sizeof(hdlc_ll_data_t) + queue_size )
+    {
+        LOG(TINY_LOG_ERR, "[HDLC] failed to init hdlc. no space for tx queue of %i frames\n", init->tx_queue_size);
+        return TINY_ERR_OUT_OF_MEMORY;
+    }
     *handle = (hdlc_ll_handle_t)aligned_buf;
-    (*handle)->rx_buf = (uint8_t *)aligned_buf + sizeof(hdlc_ll_data_t);
-    (*handle)->rx_buf_size = buf_size - sizeof(hdlc_ll_data_t);
+    (*handle)->tx.queue_size = init->tx_queue_size;
+    (*handle)->tx.queue_count = 0;
+    (*handle)->tx.origin_data = NULL;
+    (*handle)->tx.data = NULL;
+    (*handle)->rx_buf = (uint8_t *)aligned_buf + sizeof(hdlc_ll_data_t) + queue_size;
+    (*handle)->rx_buf_size = buf_size - sizeof(hdlc_ll_data_t) - queue_size;
     (*handle)->crc_type = init->crc_type == HDLC_CRC_OFF ? 0 : init->crc_type;
     (*handle)->on_frame_read = init->on_frame_read;
     (*handle)->on_frame_send = init->on_frame_send;
     (*handle)->user_data = init->user_data;
-    (*handle)->phys_mtu = init->mtu ? (init->mtu + get_crc_field_size((*handle)->crc_type)): ((*handle)->rx_buf_size);
+    (*handle)->phys_mtu = init->mtu ? (init->mtu + (uint8_t)(*handle)->crc_type / 8): ((*handle)->rx_buf_size);
+    (*handle)->shared_flag = init->shared_flag;
+    (*handle)->rx_packed = init->rx_packed;
+    (*handle)->rx_hold_mask = 0;
+    (*handle)->framing = init->framing;
+    memset(&(*handle)->stats, 0, sizeof((*handle)->stats));
     (*handle)->rx.active_frame_buf = (*handle)->rx_buf;
 
     // Must be last
@@ -103,16 +190,54 @@ int hdlc_ll_init(hdlc_ll_handle_t *handle, hdlc_ll_init_t *init)
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 
-int hdlc_ll_close(hdlc_ll_handle_t handle)
+static void hdlc_ll_tx_drain_queue(hdlc_ll_handle_t handle)
 {
-    if ( handle && handle->tx.data )
+    // Return all queued frames to the user
+    while ( handle->tx.queue_count )
     {
+        const uint8_t *data = HDLC_LL_TX_QUEUE(handle)[handle->tx.queue_head].data;
+        int len = HDLC_LL_TX_QUEUE(handle)[handle->tx.queue_head].len;
+        handle->tx.queue_head = (handle->tx.queue_head + 1) % handle->tx.queue_size;
+        handle->tx.queue_count--;
         if ( handle->on_frame_send )
         {
-            handle->on_frame_send(handle->user_data, handle->tx.origin_data,
-                                  (int)(handle->tx.data - handle->tx.origin_data) + handle->tx.len);
+            handle->on_frame_send(handle->user_data, data, len);
         }
     }
+    handle->tx.queue_head = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static void hdlc_ll_tx_return_frames(hdlc_ll_handle_t handle)
+{
+    // Return the frame being sent first, and then queued frames, in the order they were put
+    const uint8_t *data = handle->tx.origin_data;
+    int len = (int)(handle->tx.data - handle->tx.origin_data) + handle->tx.len;
+    handle->tx.origin_data = NULL;
+    handle->tx.data = NULL;
+    if ( data && handle->on_frame_send )
+    {
+        handle->on_frame_send(handle->user_data, data, len);
+    }
+    hdlc_ll_tx_drain_queue(handle);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void hdlc_ll_tx_purge(hdlc_ll_handle_t handle)
+{
+    hdlc_ll_tx_drain_queue(handle);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+int hdlc_ll_close(hdlc_ll_handle_t handle)
+{
+    if ( handle )
+    {
+        hdlc_ll_tx_return_frames(handle);
+    }
     return TINY_SUCCESS;
 }
 
@@ -122,41 +247,109 @@ void hdlc_ll_reset(hdlc_ll_handle_t handle, uint8_t flags)
 {
     if ( flags != HDLC_LL_RESET_TX_ONLY )
     {
-        handle->rx.state = hdlc_ll_read_start;
+        handle->rx.lost_sync = 0;
+        hdlc_ll_rx_hunt(handle);
     }
     if ( flags != HDLC_LL_RESET_RX_ONLY )
     {
-        handle->tx.data = NULL;
-        handle->tx.origin_data = NULL;
         handle->tx.escape = 0;
-        handle->tx.state = hdlc_ll_send_start;
+        handle->tx.skip_flag = 0;
+        handle->tx.block = 0;
+        hdlc_ll_tx_next_frame(handle);
+        hdlc_ll_tx_return_frames(handle);
     }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////
 
-static int hdlc_ll_send_start(hdlc_ll_handle_t handle)
+static crc_t hdlc_ll_crc_start(hdlc_crc_t crc_type)
 {
-    // Do not clear data ready bit here in case if 0x7F is failed to be sent
-    if ( !handle->tx.origin_data )
+    switch ( crc_type )
     {
-        // LOG(TINY_LOG_DEB, "[HDLC:%p] SENDING START NO DATA READY\n", handle);
-        return 0;
+#ifdef CONFIG_ENABLE_FCS16
+        case HDLC_CRC_16: return PPPINITFCS16;
+#endif
+#ifdef CONFIG_ENABLE_FCS32
+        case HDLC_CRC_32: return PPPINITFCS32;
+#endif
+#ifdef CONFIG_ENABLE_CRC32C
+        case HDLC_CRC_32C: return INITCRC32C;
+#endif
+#ifdef CONFIG_ENABLE_CHECKSUM
+        case HDLC_CRC_8: return INITCHECKSUM;
+#endif
+        default: break;
     }
-    LOG(TINY_LOG_INFO, "[HDLC:%p] Starting send op for HDLC frame\n", handle);
-    switch ( handle->crc_type )
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+static crc_t hdlc_ll_crc_update(hdlc_crc_t crc_type, crc_t crc, const uint8_t *data, int len)
+{
+    switch ( crc_type )
     {
 #ifdef CONFIG_ENABLE_FCS16
-        case HDLC_CRC_16: handle->tx.crc = tiny_crc16(PPPINITFCS16, handle->tx.data, handle->tx.len); break;
+        case HDLC_CRC_16: return tiny_crc16_update(crc, data, len);
 #endif
 #ifdef CONFIG_ENABLE_FCS32
-        case HDLC_CRC_32: handle->tx.crc = tiny_crc32(PPPINITFCS32, handle->tx.data, handle->tx.len); break;
+        case HDLC_CRC_32: return tiny_crc32_update(crc, data, len);
+#endif
+#ifdef CONFIG_ENABLE_CRC32C
+        case HDLC_CRC_32C: return tiny_crc32c_update(crc, data, len);
 #endif
 #ifdef CONFIG_ENABLE_CHECKSUM
-        case HDLC_CRC_8: handle->tx.crc = tiny_chksum(INITCHECKSUM, handle->tx.data, handle->tx.len); break;
+        case HDLC_CRC_8: return tiny_chksum_update(crc, data, len);
 #endif
         default: break;
     }
+    return crc;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+static crc_t hdlc_ll_crc_final(hdlc_crc_t crc_type, crc_t crc)
+{
+    switch ( crc_type )
+    {
+#ifdef CONFIG_ENABLE_FCS16
+        case HDLC_CRC_16: return (uint16_t)(crc ^ 0xFFFF);
+#endif
+#ifdef CONFIG_ENABLE_FCS32
+        case HDLC_CRC_32: return crc ^ 0xFFFFFFFF;
+#endif
+#ifdef CONFIG_ENABLE_CRC32C
+        case HDLC_CRC_32C: return crc ^ 0xFFFFFFFF;
+#endif
+#ifdef CONFIG_ENABLE_CHECKSUM
+        case HDLC_CRC_8: return (uint16_t)(0xFFFF - crc);
+#endif
+        default: break;
+    }
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+static int hdlc_ll_send_start(hdlc_ll_handle_t handle)
+{
+    // Do not clear data ready bit here in case if 0x7F is failed to be sent
+    if ( !handle->tx.origin_data )
+    {
+        // LOG(TINY_LOG_DEB, "[HDLC:%p] SENDING START NO DATA READY\n", handle);
+        return 0;
+    }
+    LOG(TINY_LOG_INFO, "[HDLC:%p] Starting send op for HDLC frame\n", handle);
+    // crc is updated on the fly, while payload bytes are being sent
+    handle->tx.crc = hdlc_ll_crc_start(handle->crc_type);
+    if ( handle->tx.skip_flag )
+    {
+        LOG(TINY_LOG_DEB, "[HDLC:%p] hdlc_ll_send_data (shared flag)\n", handle);
+        handle->tx.state = hdlc_ll_send_data;
+        handle->tx.escape = 0;
+        handle->tx.skip_flag = 0;
+        return 0;
+    }
 
     uint8_t buf[1] = {FLAG_SEQUENCE};
     int result = hdlc_ll_send_tx_internal(handle, buf, sizeof(buf));
@@ -181,11 +374,7 @@ static int hdlc_ll_send_data(hdlc_ll_handle_t handle)
     //    handle->tx.state = hdlc_ll_send_crc;
     //    return 0;
     //}
-    int pos = 0;
-    while ( handle->tx.data[pos] != FLAG_SEQUENCE && handle->tx.data[pos] != TINY_ESCAPE_CHAR && pos < handle->tx.len )
-    {
-        pos++;
-    }
+    int pos = handle->tx.escape ? 0 : hdlc_scan_special(handle->tx.data, handle->tx.len);
     int result = 0;
     if ( pos )
     {
@@ -196,6 +385,7 @@ static int hdlc_ll_send_data(hdlc_ll_handle_t handle)
             for ( int i = 0; i < result; i++ )
                 LOG(TINY_LOG_DEB, "[HDLC:%p] TX: %02X\n", handle, handle->tx.data[i]);
 #endif
+            handle->tx.crc = hdlc_ll_crc_update(handle->crc_type, handle->tx.crc, handle->tx.data, result);
             handle->tx.data += result;
             handle->tx.len -= result;
         }
@@ -208,8 +398,13 @@ static int hdlc_ll_send_data(hdlc_ll_handle_t handle)
         {
             LOG(TINY_LOG_DEB, "[HDLC:%p] TX: %02X\n", handle, buf[0]);
             handle->tx.escape = !handle->tx.escape;
-            if ( !handle->tx.escape )
+            if ( handle->tx.escape )
             {
+                handle->stats.tx_escapes++;
+            }
+            else
+            {
+                handle->tx.crc = hdlc_ll_crc_update(handle->crc_type, handle->tx.crc, handle->tx.data, 1);
                 handle->tx.data++;
                 handle->tx.len--;
             }
@@ -218,6 +413,7 @@ static int hdlc_ll_send_data(hdlc_ll_handle_t handle)
     if ( handle->tx.len == 0 )
     {
         LOG(TINY_LOG_DEB, "[HDLC:%p] hdlc_ll_send_crc\n", handle);
+        handle->tx.crc = hdlc_ll_crc_final(handle->crc_type, handle->tx.crc);
         handle->tx.state = hdlc_ll_send_crc;
     }
     return result;
@@ -228,7 +424,7 @@ static int hdlc_ll_send_data(hdlc_ll_handle_t handle)
 static int hdlc_ll_send_crc(hdlc_ll_handle_t handle)
 {
     int result = 1;
-    if ( handle->tx.len == (uint8_t)handle->crc_type )
+    if ( handle->tx.len == (uint8_t)handle->crc_type / 8 * 8 )
     {
         handle->tx.state = hdlc_ll_send_end;
     }
@@ -252,7 +448,11 @@ static int hdlc_ll_send_crc(hdlc_ll_handle_t handle)
             {
                 LOG(TINY_LOG_DEB, "[HDLC:%p] TX: %02X\n", handle, byte);
                 handle->tx.escape = !handle->tx.escape;
-                if ( !handle->tx.escape )
+                if ( handle->tx.escape )
+                {
+                    handle->stats.tx_escapes++;
+                }
+                else
                 {
                     handle->tx.len += 8;
                 }
@@ -264,6 +464,35 @@ static int hdlc_ll_send_crc(hdlc_ll_handle_t handle)
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 
+static void hdlc_ll_send_done(hdlc_ll_handle_t handle)
+{
+    hdlc_ll_tx_next_frame(handle);
+    handle->tx.escape = 0;
+    int len = (int)(handle->tx.data - handle->tx.origin_data);
+    const void *ptr = handle->tx.origin_data;
+    handle->tx.origin_data = NULL;
+    handle->tx.data = NULL;
+    handle->stats.tx_frames++;
+    handle->stats.tx_bytes += (uint32_t)len;
+    if ( handle->tx.queue_count )
+    {
+        // Next frame goes right after the closing flag of the current one
+        handle->tx.origin_data = HDLC_LL_TX_QUEUE(handle)[handle->tx.queue_head].data;
+        handle->tx.data = handle->tx.origin_data;
+        handle->tx.len = HDLC_LL_TX_QUEUE(handle)[handle->tx.queue_head].len;
+        handle->tx.queue_head = (handle->tx.queue_head + 1) % handle->tx.queue_size;
+        handle->tx.queue_count--;
+        // Frame starting with fill byte cannot share the flag, since remote side skips fill bytes between frames
+        handle->tx.skip_flag = handle->shared_flag && handle->tx.data[0] != FILL_BYTE;
+    }
+    if ( handle->on_frame_send )
+    {
+        handle->on_frame_send(handle->user_data, ptr, len);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
 static int hdlc_ll_send_end(hdlc_ll_handle_t handle)
 {
     LOG(TINY_LOG_DEB, "[HDLC:%p] hdlc_ll_send_end\n", handle);
@@ -273,16 +502,7 @@ static int hdlc_ll_send_end(hdlc_ll_handle_t handle)
     {
         LOG(TINY_LOG_DEB, "[HDLC:%p] TX: %02X\n", handle, buf[0]);
         LOG(TINY_LOG_INFO, "[HDLC:%p] hdlc_ll_send_end HDLC send op successful\n", handle);
-        handle->tx.state = hdlc_ll_send_start;
-        handle->tx.escape = 0;
-        int len = (int)(handle->tx.data - handle->tx.origin_data);
-        const void *ptr = handle->tx.origin_data;
-        handle->tx.origin_data = NULL;
-        handle->tx.data = NULL;
-        if ( handle->on_frame_send )
-        {
-            handle->on_frame_send(handle->user_data, ptr, len);
-        }
+        hdlc_ll_send_done(handle);
     }
     return result;
 }
@@ -291,17 +511,71 @@ static int hdlc_ll_send_end(hdlc_ll_handle_t handle)
 
 static int hdlc_ll_send_tx_internal(hdlc_ll_handle_t handle, const void *data, int len)
 {
-    const uint8_t *ptr = (const uint8_t *)data;
-    int sent = 0;
-    while ( len-- && handle->tx.out_buffer_len )
+    int sent = len < handle->tx.out_buffer_len ? len : handle->tx.out_buffer_len;
+    memcpy(handle->tx.out_buffer, data, sent);
+    handle->tx.out_buffer += sent;
+    handle->tx.out_buffer_len -= sent;
+    return sent;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static uint8_t *hdlc_ll_stuff_block(hdlc_ll_handle_t handle, uint8_t *out, const uint8_t *data, int len, crc_t *crc)
+{
+    while ( len > 0 )
     {
-        handle->tx.out_buffer[0] = ptr[0];
-        handle->tx.out_buffer_len--;
-        handle->tx.out_buffer++;
-        ptr++;
-        sent++;
+        int pos = hdlc_scan_special(data, len);
+        memcpy(out, data, pos);
+        if ( crc )
+        {
+            // Include escaped byte to the crc right away, while the data is still in the cache
+            *crc = hdlc_ll_crc_update(handle->crc_type, *crc, data, pos < len ? pos + 1 : pos);
+        }
+        out += pos;
+        data += pos;
+        len -= pos;
+        if ( len > 0 )
+        {
+            out[0] = TINY_ESCAPE_CHAR;
+            out[1] = data[0] ^ TINY_ESCAPE_BIT;
+            out += 2;
+            data++;
+            len--;
+            handle->stats.tx_escapes++;
+        }
     }
-    return sent;
+    return out;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static void hdlc_ll_send_frame_block(hdlc_ll_handle_t handle)
+{
+    // Block mode: the whole frame fits the output buffer even if every byte needs escaping,
+    // so there is no need to check output buffer bounds and to walk through tx states.
+    uint8_t *out = handle->tx.out_buffer;
+    uint8_t crc[4];
+    int crc_len = (uint8_t)handle->crc_type / 8;
+    handle->tx.crc = hdlc_ll_crc_start(handle->crc_type);
+    if ( !handle->tx.skip_flag )
+    {
+        *out++ = FLAG_SEQUENCE;
+    }
+    handle->tx.skip_flag = 0;
+    out = hdlc_ll_stuff_block(handle, out, handle->tx.data, handle->tx.len, &handle->tx.crc);
+    handle->tx.crc = hdlc_ll_crc_final(handle->crc_type, handle->tx.crc);
+    for ( int i = 0; i < crc_len; i++ )
+    {
+        crc[i] = (uint8_t)(handle->tx.crc >> (i * 8));
+    }
+    out = hdlc_ll_stuff_block(handle, out, crc, crc_len, NULL);
+    *out++ = FLAG_SEQUENCE;
+    LOG(TINY_LOG_INFO, "[HDLC:%p] HDLC frame encoded in block mode: %d bytes\n", handle, (int)(out - handle->tx.out_buffer));
+    handle->tx.out_buffer_len -= (int)(out - handle->tx.out_buffer);
+    handle->tx.out_buffer = out;
+    handle->tx.data += handle->tx.len;
+    handle->tx.len = 0;
+    hdlc_ll_send_done(handle);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -313,6 +587,13 @@ int hdlc_ll_run_tx(hdlc_ll_handle_t handle, void *data, int len)
     handle->tx.out_buffer_len = len;
     while ( handle->tx.out_buffer_len )
     {
+        if ( handle->framing == HDLC_FRAMING_HDLC && handle->tx.state == hdlc_ll_send_start && handle->tx.origin_data &&
+             handle->tx.out_buffer_len >= HDLC_LL_MAX_FRAME_SIZE(handle->tx.len, handle->crc_type) )
+        {
+            hdlc_ll_send_frame_block(handle);
+            repeated_empty_data = false;
+            continue;
+        }
         int result = handle->tx.state(handle);
         if ( result < 0 )
         {
@@ -362,7 +643,7 @@ int hdlc_ll_put_frame(hdlc_ll_handle_t handle, const void *data, int len)
         return TINY_ERR_INVALID_DATA;
     }
     // Check if TX thread is ready to accept new data
-    if ( handle->tx.origin_data )
+    if ( handle->tx.origin_data && handle->tx.queue_count >= handle->tx.queue_size )
     {
         LOG(TINY_LOG_WRN, "[HDLC:%p] hdlc_ll_put FAILED\n", handle);
         return TINY_ERR_BUSY;
@@ -371,6 +652,20 @@ int hdlc_ll_put_frame(hdlc_ll_handle_t handle, const void *data, int len)
     {
         return TINY_SUCCESS;
     }
+    if ( handle->framing == HDLC_FRAMING_LENGTH && len + (uint8_t)handle->crc_type / 8 > 0xFFFF )
+    {
+        LOG(TINY_LOG_ERR, "[HDLC:%p] hdlc_ll_put frame is too long for length field: %i\n", handle, len);
+        return TINY_ERR_DATA_TOO_LARGE;
+    }
+    if ( handle->tx.origin_data )
+    {
+        int index = (handle->tx.queue_head + handle->tx.queue_count) % handle->tx.queue_size;
+        HDLC_LL_TX_QUEUE(handle)[index].data = (const uint8_t *)data;
+        HDLC_LL_TX_QUEUE(handle)[index].len = len;
+        handle->tx.queue_count++;
+        LOG(TINY_LOG_DEB, "[HDLC:%p] hdlc_ll_put SUCCESS (queued %i)\n", handle, handle->tx.queue_count);
+        return TINY_SUCCESS;
+    }
     LOG(TINY_LOG_DEB, "[HDLC:%p] hdlc_ll_put SUCCESS\n", handle);
     handle->tx.origin_data = data;
     handle->tx.data = data;
@@ -380,25 +675,97 @@ int hdlc_ll_put_frame(hdlc_ll_handle_t handle, const void *data, int len)
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 
+static void hdlc_ll_read_begin(hdlc_ll_handle_t handle)
+{
+    handle->rx.escape = 0;
+    handle->rx.block = 0;
+    handle->rx.overflow = 0;
+    handle->rx.ptr = handle->rx.active_frame_buf;
+    handle->rx.crc_ptr = handle->rx.active_frame_buf;
+    handle->rx.crc = hdlc_ll_crc_start(handle->crc_type);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static void hdlc_ll_rx_discard(hdlc_ll_handle_t handle, const uint8_t *data, int len)
+{
+    handle->stats.rx_discarded_bytes += (uint32_t)len;
+    // Fill bytes between frames do not mean that frame alignment is lost
+    while ( !handle->rx.lost_sync && len-- )
+    {
+        handle->rx.lost_sync = *data++ != FILL_BYTE;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static void hdlc_ll_rx_found_start(hdlc_ll_handle_t handle, const uint8_t *data, int discarded)
+{
+    hdlc_ll_rx_discard(handle, data, discarded);
+    if ( handle->rx.lost_sync )
+    {
+        handle->stats.rx_resyncs++;
+        handle->rx.lost_sync = 0;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
 static int hdlc_ll_read_start(hdlc_ll_handle_t handle, const uint8_t *data, int len)
 {
     if ( !len )
     {
         return 0;
     }
-    if ( data[0] != FLAG_SEQUENCE )
+    // Jump to the next flag at once, all bytes before it are either fill bytes or garbage
+    const uint8_t *flag = (const uint8_t *)memchr(data, FLAG_SEQUENCE, len);
+    if ( !flag )
+    {
+        hdlc_ll_rx_discard(handle, data, len);
+        return len;
+    }
+    hdlc_ll_rx_found_start(handle, data, (int)(flag - data));
+    LOG(TINY_LOG_DEB, "[HDLC:%p] RX: %02X\n", handle, flag[0]);
+    hdlc_ll_read_begin(handle);
+    handle->rx.state = hdlc_ll_read_data;
+    return (int)(flag - data) + 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static int hdlc_ll_read_idle(hdlc_ll_handle_t handle, const uint8_t *data, int len)
+{
+    // Closing flag of the previous frame can be opening flag of the next one
+    if ( !len )
+    {
+        return 0;
+    }
+    if ( data[0] == FILL_BYTE )
     {
-        if ( data[0] != FILL_BYTE )
-        {
-            // TODO: Skip byte, but we received some wrong data
-        }
         return 1;
     }
-    LOG(TINY_LOG_DEB, "[HDLC:%p] RX: %02X\n", handle, data[0]);
-    handle->rx.escape = 0;
-    handle->rx.ptr = handle->rx.active_frame_buf;
+    hdlc_ll_read_begin(handle);
     handle->rx.state = hdlc_ll_read_data;
-    return 1;
+    if ( data[0] == FLAG_SEQUENCE )
+    {
+        LOG(TINY_LOG_DEB, "[HDLC:%p] RX: %02X\n", handle, data[0]);
+        return 1;
+    }
+    // This byte is the first byte of the frame
+    return hdlc_ll_read_data(handle, data, len);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static void hdlc_ll_read_crc_update(hdlc_ll_handle_t handle)
+{
+    // Last bytes received can be crc field, so crc calculation lags behind by crc field size
+    int len = (int)(handle->rx.ptr - handle->rx.crc_ptr) - (uint8_t)handle->crc_type / 8;
+    if ( len > 0 )
+    {
+        handle->rx.crc = hdlc_ll_crc_update(handle->crc_type, handle->rx.crc, handle->rx.crc_ptr, len);
+        handle->rx.crc_ptr += len;
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
@@ -408,6 +775,33 @@ static int hdlc_ll_read_data(hdlc_ll_handle_t handle, const uint8_t *data, int l
     int result = 0;
     while ( len > 0 )
     {
+        if ( !handle->rx.escape )
+        {
+            // Fast path: copy all bytes up to the next flag or escape char at once
+            int clean = hdlc_scan_special(data, len);
+            if ( clean > 0 )
+            {
+                int room = handle->phys_mtu - (int)(handle->rx.ptr - handle->rx.active_frame_buf);
+                int copy = clean < room ? clean : (room > 0 ? room : 0);
+#if TINY_HDLC_DEBUG
+                for ( int i = 0; i < clean; i++ )
+                    LOG(TINY_LOG_DEB, "[HDLC:%p] RX: %02X\n", handle, data[i]);
+#endif
+                memcpy(handle->rx.ptr, data, copy);
+                handle->rx.ptr += copy;
+                hdlc_ll_read_crc_update(handle);
+                if ( copy < clean )
+                {
+                    handle->rx.overflow = 1;
+                    LOG(TINY_LOG_WRN, "[HDLC:%p] No space for %i incoming bytes: len=%i (mtu = %i)\n",
+                                      handle, clean - copy, (int)(handle->rx.ptr - handle->rx.active_frame_buf), handle->phys_mtu);
+                }
+                result += clean;
+                data += clean;
+                len -= clean;
+                continue;
+            }
+        }
         uint8_t byte = data[0];
         LOG(TINY_LOG_DEB, "[HDLC:%p] RX: %02X\n", handle, byte);
         if ( byte == FLAG_SEQUENCE )
@@ -435,6 +829,7 @@ static int hdlc_ll_read_data(hdlc_ll_handle_t handle, const uint8_t *data, int l
         }
         else
         {
+            handle->rx.overflow = 1;
             LOG(TINY_LOG_WRN, "[HDLC:%p] No space for incoming byte: len=%i (mtu = %i)\n",
                               handle, (int)(handle->rx.ptr - handle->rx.active_frame_buf), handle->phys_mtu);
         }
@@ -442,23 +837,45 @@ static int hdlc_ll_read_data(hdlc_ll_handle_t handle, const uint8_t *data, int l
         data++;
         len--;
     }
+    hdlc_ll_read_crc_update(handle);
     return result;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 
+static uint32_t hdlc_ll_rx_slot_bit(hdlc_ll_handle_t handle, const uint8_t *data)
+{
+    int slot = (int)(data - handle->rx_buf) / handle->phys_mtu;
+    return slot < 32 ? ((uint32_t)1 << slot) : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static int hdlc_ll_rx_slots(hdlc_ll_handle_t handle)
+{
+    int slots = handle->rx_buf_size / handle->phys_mtu;
+    return slots < 32 ? slots : 32;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
 static int hdlc_ll_read_end(hdlc_ll_handle_t handle, const uint8_t *data, int len_bytes)
 {
     if ( handle->rx.ptr == handle->rx.active_frame_buf )
     {
         // Impossible, maybe frame alignment is wrong, go to read data again
         LOG(TINY_LOG_WRN, "[HDLC:%p] RX: error in frame alignment, recovering...\n", handle);
+        handle->stats.rx_resyncs++;
         handle->rx.escape = 0;
         handle->rx.state = hdlc_ll_read_data;
         return 0; // That's OK, we actually didn't process anything from user bytes
     }
-    handle->rx.state = hdlc_ll_read_start;
+    hdlc_ll_rx_next_frame(handle);
     int len = (int)(handle->rx.ptr - handle->rx.active_frame_buf);
+    if ( handle->rx.overflow )
+    {
+        handle->stats.rx_oversize_frames++;
+    }
     if ( len > handle->phys_mtu )
     {
         // Buffer size issue, too long packet
@@ -469,27 +886,34 @@ static int hdlc_ll_read_end(hdlc_ll_handle_t handle, const uint8_t *data, int le
     {
         // CRC size issue
         LOG(TINY_LOG_ERR, "[HDLC:%p] RX: crc field is too short\n", handle);
+        handle->stats.rx_crc_errors++;
         return TINY_ERR_WRONG_CRC;
     }
+    hdlc_ll_read_crc_update(handle);
     crc_t calc_crc = 0;
     crc_t read_crc = 0;
     switch ( handle->crc_type )
     {
 #ifdef CONFIG_ENABLE_CHECKSUM
         case HDLC_CRC_8:
-            calc_crc = tiny_chksum(INITCHECKSUM, handle->rx.active_frame_buf, len - 1) & 0x00FF;
+            calc_crc = hdlc_ll_crc_final(handle->crc_type, handle->rx.crc) & 0x00FF;
             read_crc = handle->rx.ptr[-1];
             break;
 #endif
 #ifdef CONFIG_ENABLE_FCS16
         case HDLC_CRC_16:
-            calc_crc = tiny_crc16(PPPINITFCS16, handle->rx.active_frame_buf, len - 2);
+            calc_crc = hdlc_ll_crc_final(handle->crc_type, handle->rx.crc);
             read_crc = handle->rx.ptr[-2] | ((uint16_t)handle->rx.ptr[-1] << 8);
             break;
 #endif
+#if defined(CONFIG_ENABLE_FCS32) || defined(CONFIG_ENABLE_CRC32C)
 #ifdef CONFIG_ENABLE_FCS32
         case HDLC_CRC_32:
-            calc_crc = tiny_crc32(PPPINITFCS32, handle->rx.active_frame_buf, len - 4);
+#endif
+#ifdef CONFIG_ENABLE_CRC32C
+        case HDLC_CRC_32C:
+#endif
+            calc_crc = hdlc_ll_crc_final(handle->crc_type, handle->rx.crc);
             read_crc = handle->rx.ptr[-4] | ((uint32_t)handle->rx.ptr[-3] << 8) |
                        ((uint32_t)handle->rx.ptr[-2] << 16) | ((uint32_t)handle->rx.ptr[-1] << 24);
             break;
@@ -510,25 +934,417 @@ static int hdlc_ll_read_end(hdlc_ll_handle_t handle, const uint8_t *data, int le
                 fprintf(stderr, " %02X ", (handle->rx.active_frame_buf)[i]);
         LOG(TINY_LOG_DEB, "\n%s\n","------------");
 #endif
+        handle->stats.rx_crc_errors++;
         return TINY_ERR_WRONG_CRC;
     }
     // Shift back data pointer, pointing to the last byte after payload
     len -= (uint8_t)handle->crc_type / 8;
     LOG(TINY_LOG_INFO, "[HDLC:%p] RX: Frame success: %d bytes\n", handle, len);
+    handle->stats.rx_frames++;
+    handle->stats.rx_bytes += (uint32_t)len;
     if ( handle->on_frame_read )
     {
         handle->on_frame_read(handle->user_data, handle->rx.active_frame_buf, len);
     }
-    handle->rx.active_frame_buf += handle->phys_mtu;
-    if ( handle->rx.active_frame_buf - handle->rx_buf + handle->phys_mtu > handle->rx_buf_size )
+    // Packed mode: next frame starts right after crc field of this frame
+    do
     {
-        handle->rx.active_frame_buf = handle->rx_buf;
-    }
+        handle->rx.active_frame_buf = handle->rx_packed ? handle->rx.ptr : handle->rx.active_frame_buf + handle->phys_mtu;
+        if ( handle->rx.active_frame_buf - handle->rx_buf + handle->phys_mtu > handle->rx_buf_size )
+        {
+            handle->rx.active_frame_buf = handle->rx_buf;
+        }
+        // Skip slots held by the user, hdlc_ll_rx_hold() always leaves one slot free
+    } while ( handle->rx_hold_mask & hdlc_ll_rx_slot_bit( handle, handle->rx.active_frame_buf ) );
     return TINY_SUCCESS;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
 
+/**************************************************************************************
+ *
+ * COBS framing: 0x00 <COBS encoded payload and crc> 0x00
+ *
+ **************************************************************************************/
+
+static int hdlc_ll_cobs_read_start(hdlc_ll_handle_t handle, const uint8_t *data, int len)
+{
+    if ( !len )
+    {
+        return 0;
+    }
+    const uint8_t *delimiter = (const uint8_t *)memchr(data, COBS_DELIMITER, len);
+    if ( !delimiter )
+    {
+        hdlc_ll_rx_discard(handle, data, len);
+        return len;
+    }
+    hdlc_ll_rx_found_start(handle, data, (int)(delimiter - data));
+    handle->rx.state = hdlc_ll_cobs_read_idle;
+    return (int)(delimiter - data) + 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static int hdlc_ll_cobs_read_idle(hdlc_ll_handle_t handle, const uint8_t *data, int len)
+{
+    if ( !len )
+    {
+        return 0;
+    }
+    hdlc_ll_read_begin(handle);
+    handle->rx.state = hdlc_ll_cobs_read_data;
+    return hdlc_ll_cobs_read_data(handle, data, len);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static void hdlc_ll_cobs_read_store(hdlc_ll_handle_t handle, const uint8_t *data, int len)
+{
+    int room = handle->phys_mtu - (int)(handle->rx.ptr - handle->rx.active_frame_buf);
+    int copy = len < room ? len : (room > 0 ? room : 0);
+    memcpy(handle->rx.ptr, data, copy);
+    handle->rx.ptr += copy;
+    if ( copy < len )
+    {
+        handle->rx.overflow = 1;
+        LOG(TINY_LOG_WRN, "[HDLC:%p] No space for %i incoming bytes: len=%i (mtu = %i)\n",
+                          handle, len - copy, (int)(handle->rx.ptr - handle->rx.active_frame_buf), handle->phys_mtu);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static int hdlc_ll_cobs_read_data(hdlc_ll_handle_t handle, const uint8_t *data, int len)
+{
+    int result = 0;
+    while ( len > 0 )
+    {
+        if ( data[0] == COBS_DELIMITER )
+        {
+            result++;
+            if ( handle->rx.ptr == handle->rx.active_frame_buf )
+            {
+                // Empty frame, that is just a delimiter, shared by two frames
+                hdlc_ll_read_begin(handle);
+                data++;
+                len--;
+                continue;
+            }
+            // Zero byte, pending at the end of the last block, is not part of the frame
+            handle->rx.state = hdlc_ll_read_end;
+            break;
+        }
+        if ( handle->rx.block == 0 )
+        {
+            uint8_t zero = COBS_DELIMITER;
+            if ( handle->rx.escape )
+            {
+                hdlc_ll_cobs_read_store(handle, &zero, 1);
+            }
+            handle->rx.block = data[0] - 1;
+            handle->rx.escape = data[0] != COBS_MAX_BLOCK + 1;
+            result++;
+            data++;
+            len--;
+            continue;
+        }
+        int chunk = len < handle->rx.block ? len : handle->rx.block;
+        const uint8_t *delimiter = (const uint8_t *)memchr(data, COBS_DELIMITER, chunk);
+        if ( delimiter )
+        {
+            // Broken block, frame is terminated too early. Let crc check to reject the frame
+            chunk = (int)(delimiter - data);
+        }
+        hdlc_ll_cobs_read_store(handle, data, chunk);
+        hdlc_ll_read_crc_update(handle);
+        handle->rx.block -= chunk;
+        result += chunk;
+        data += chunk;
+        len -= chunk;
+    }
+    hdlc_ll_read_crc_update(handle);
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static int hdlc_ll_tx_left(hdlc_ll_handle_t handle)
+{
+    return handle->tx.len + handle->tx.crc_left;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static uint8_t hdlc_ll_tx_crc_byte(hdlc_ll_handle_t handle, int offset)
+{
+    int index = (uint8_t)handle->crc_type / 8 - handle->tx.crc_left + offset;
+    return (uint8_t)(handle->tx.crc >> (index * 8));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static void hdlc_ll_tx_skip(hdlc_ll_handle_t handle, int len)
+{
+    int payload = len < handle->tx.len ? len : handle->tx.len;
+    handle->tx.data += payload;
+    handle->tx.len -= payload;
+    handle->tx.crc_left -= len - payload;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static void hdlc_ll_cobs_next_block(hdlc_ll_handle_t handle)
+{
+    // Block with code less than 0xFF is followed by zero byte, if it is not the last block
+    bool zero = handle->tx.code != COBS_MAX_BLOCK + 1 && hdlc_ll_tx_left(handle) > 0;
+    if ( zero )
+    {
+        hdlc_ll_tx_skip(handle, 1);
+    }
+    else if ( hdlc_ll_tx_left(handle) == 0 )
+    {
+        handle->tx.state = hdlc_ll_cobs_send_end;
+        return;
+    }
+    // Look for the next zero byte. crc is calculated over payload bytes, when they are scanned
+    int len = 0;
+    bool found = false;
+    if ( handle->tx.len > 0 )
+    {
+        int max = handle->tx.len < COBS_MAX_BLOCK ? handle->tx.len : COBS_MAX_BLOCK;
+        const uint8_t *delimiter = (const uint8_t *)memchr(handle->tx.data, COBS_DELIMITER, max);
+        len = delimiter ? (int)(delimiter - handle->tx.data) : max;
+        found = delimiter != NULL;
+        int scanned = found ? len + 1 : len;
+        handle->tx.crc = hdlc_ll_crc_update(handle->crc_type, handle->tx.crc, handle->tx.data, scanned);
+        if ( scanned == handle->tx.len )
+        {
+            handle->tx.crc = hdlc_ll_crc_final(handle->crc_type, handle->tx.crc);
+        }
+    }
+    while ( !found && len < COBS_MAX_BLOCK && len < hdlc_ll_tx_left(handle) )
+    {
+        if ( hdlc_ll_tx_crc_byte(handle, len - handle->tx.len) == COBS_DELIMITER )
+        {
+            break;
+        }
+        len++;
+    }
+    handle->tx.block = len;
+    handle->tx.code = len + 1;
+    handle->tx.state = hdlc_ll_cobs_send_code;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static int hdlc_ll_cobs_send_start(hdlc_ll_handle_t handle)
+{
+    if ( !handle->tx.origin_data )
+    {
+        return 0;
+    }
+    LOG(TINY_LOG_INFO, "[HDLC:%p] Starting send op for COBS frame\n", handle);
+    int result = 0;
+    if ( !handle->tx.skip_flag )
+    {
+        uint8_t buf[1] = {COBS_DELIMITER};
+        result = hdlc_ll_send_tx_internal(handle, buf, sizeof(buf));
+        if ( result != 1 )
+        {
+            return result;
+        }
+    }
+    handle->tx.skip_flag = 0;
+    handle->tx.crc = hdlc_ll_crc_start(handle->crc_type);
+    handle->tx.crc_left = (uint8_t)handle->crc_type / 8;
+    // There is no zero byte before the first block
+    handle->tx.code = COBS_MAX_BLOCK + 1;
+    hdlc_ll_cobs_next_block(handle);
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static int hdlc_ll_cobs_send_code(hdlc_ll_handle_t handle)
+{
+    int result = hdlc_ll_send_tx_internal(handle, &handle->tx.code, 1);
+    if ( result == 1 )
+    {
+        handle->tx.state = hdlc_ll_cobs_send_block;
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static int hdlc_ll_cobs_send_block(hdlc_ll_handle_t handle)
+{
+    int result = 0;
+    if ( handle->tx.block && handle->tx.len )
+    {
+        result = hdlc_ll_send_tx_internal(handle, handle->tx.data,
+                                          handle->tx.block < handle->tx.len ? handle->tx.block : handle->tx.len);
+    }
+    else if ( handle->tx.block )
+    {
+        uint8_t byte = hdlc_ll_tx_crc_byte(handle, 0);
+        result = hdlc_ll_send_tx_internal(handle, &byte, 1);
+    }
+    hdlc_ll_tx_skip(handle, result);
+    handle->tx.block -= result;
+    if ( handle->tx.block == 0 )
+    {
+        hdlc_ll_cobs_next_block(handle);
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static int hdlc_ll_cobs_send_end(hdlc_ll_handle_t handle)
+{
+    uint8_t buf[1] = {COBS_DELIMITER};
+    int result = hdlc_ll_send_tx_internal(handle, buf, sizeof(buf));
+    if ( result == 1 )
+    {
+        LOG(TINY_LOG_INFO, "[HDLC:%p] COBS send op successful\n", handle);
+        hdlc_ll_send_done(handle);
+    }
+    return result;
+}
+
+/**************************************************************************************
+ *
+ * Length-prefixed framing: 0x7E <16-bit little-endian length> <payload and crc>
+ *
+ **************************************************************************************/
+
+static int hdlc_ll_length_read_start(hdlc_ll_handle_t handle, const uint8_t *data, int len)
+{
+    if ( !len )
+    {
+        return 0;
+    }
+    const uint8_t *marker = (const uint8_t *)memchr(data, LENGTH_MARKER, len);
+    if ( !marker )
+    {
+        hdlc_ll_rx_discard(handle, data, len);
+        return len;
+    }
+    hdlc_ll_rx_found_start(handle, data, (int)(marker - data));
+    hdlc_ll_read_begin(handle);
+    handle->rx.block = 1;
+    handle->rx.frame_len = 0;
+    handle->rx.state = hdlc_ll_length_read_header;
+    return (int)(marker - data) + 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static int hdlc_ll_length_read_header(hdlc_ll_handle_t handle, const uint8_t *data, int len)
+{
+    if ( !len )
+    {
+        return 0;
+    }
+    handle->rx.frame_len |= (uint16_t)data[0] << ((handle->rx.block - 1) * 8);
+    handle->rx.block++;
+    if ( handle->rx.block < LENGTH_HEADER_SIZE )
+    {
+        return 1;
+    }
+    if ( handle->rx.frame_len > handle->phys_mtu )
+    {
+        LOG(TINY_LOG_ERR, "[HDLC:%p] RX: tool long frame: %i\n", handle, handle->rx.frame_len);
+        handle->stats.rx_oversize_frames++;
+        handle->rx.state = hdlc_ll_length_read_start;
+        return TINY_ERR_DATA_TOO_LARGE;
+    }
+    // Zero length frames are not allowed, so this is not a frame start
+    handle->rx.state = handle->rx.frame_len ? hdlc_ll_length_read_data : hdlc_ll_length_read_start;
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static int hdlc_ll_length_read_data(hdlc_ll_handle_t handle, const uint8_t *data, int len)
+{
+    int chunk = len < handle->rx.frame_len ? len : handle->rx.frame_len;
+    memcpy(handle->rx.ptr, data, chunk);
+    handle->rx.ptr += chunk;
+    handle->rx.frame_len -= chunk;
+    hdlc_ll_read_crc_update(handle);
+    if ( handle->rx.frame_len == 0 )
+    {
+        handle->rx.state = hdlc_ll_read_end;
+    }
+    return chunk;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static int hdlc_ll_length_send_start(hdlc_ll_handle_t handle)
+{
+    if ( !handle->tx.origin_data )
+    {
+        return 0;
+    }
+    if ( handle->tx.block == 0 )
+    {
+        LOG(TINY_LOG_INFO, "[HDLC:%p] Starting send op for length-prefixed frame\n", handle);
+        handle->tx.crc = hdlc_ll_crc_start(handle->crc_type);
+    }
+    int len = handle->tx.len + (uint8_t)handle->crc_type / 8;
+    uint8_t header[LENGTH_HEADER_SIZE] = {LENGTH_MARKER, (uint8_t)len, (uint8_t)(len >> 8)};
+    int result = hdlc_ll_send_tx_internal(handle, header + handle->tx.block, LENGTH_HEADER_SIZE - handle->tx.block);
+    handle->tx.block += result;
+    if ( handle->tx.block == LENGTH_HEADER_SIZE )
+    {
+        handle->tx.block = 0;
+        handle->tx.state = hdlc_ll_length_send_data;
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static int hdlc_ll_length_send_data(hdlc_ll_handle_t handle)
+{
+    int result = hdlc_ll_send_tx_internal(handle, handle->tx.data, handle->tx.len);
+    handle->tx.crc = hdlc_ll_crc_update(handle->crc_type, handle->tx.crc, handle->tx.data, result);
+    handle->tx.data += result;
+    handle->tx.len -= result;
+    if ( handle->tx.len == 0 )
+    {
+        handle->tx.crc = hdlc_ll_crc_final(handle->crc_type, handle->tx.crc);
+        handle->tx.crc_left = (uint8_t)handle->crc_type / 8;
+        handle->tx.state = hdlc_ll_length_send_crc;
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+static int hdlc_ll_length_send_crc(hdlc_ll_handle_t handle)
+{
+    int result = 0;
+    if ( handle->tx.crc_left )
+    {
+        uint8_t byte = hdlc_ll_tx_crc_byte(handle, 0);
+        result = hdlc_ll_send_tx_internal(handle, &byte, 1);
+        handle->tx.crc_left -= result;
+    }
+    if ( handle->tx.crc_left == 0 )
+    {
+        LOG(TINY_LOG_INFO, "[HDLC:%p] length-prefixed send op successful\n", handle);
+        hdlc_ll_send_done(handle);
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
 int hdlc_ll_run_rx(hdlc_ll_handle_t handle, const void *data, int len, int *error)
 {
     int result = 0;
@@ -565,9 +1381,103 @@ int hdlc_ll_get_buf_size(int mtu)
 ////////////////////////////////////////////////////////////////////////////////////////////
 
 int hdlc_ll_get_buf_size_ex(int mtu, hdlc_crc_t crc_type, int rx_window)
+{
+    return hdlc_ll_get_buf_size_ex2(mtu, crc_type, rx_window, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+int hdlc_ll_get_buf_size_ex2(int mtu, hdlc_crc_t crc_type, int rx_window, int tx_queue_size)
 {
     // TINY_ALIGN_STRUCT_VALUE is added to satisfy alignment requirements
-    return (get_crc_field_size(crc_type) + mtu) * rx_window + sizeof(hdlc_ll_data_t) + TINY_ALIGN_STRUCT_VALUE - 1;
+    return (get_crc_field_size(crc_type) + mtu) * rx_window + sizeof(hdlc_ll_data_t) +
+           HDLC_TX_QUEUE_BUF_SIZE(tx_queue_size) + TINY_ALIGN_STRUCT_VALUE - 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+int hdlc_ll_rx_free_slots(hdlc_ll_handle_t handle)
+{
+    if ( handle->rx_packed )
+    {
+        return 0;
+    }
+    int held = 0;
+    for ( uint32_t mask = handle->rx_hold_mask; mask; mask &= mask - 1 )
+    {
+        held++;
+    }
+    // One slot must stay free for receiving new frames
+    int slots = handle->rx_buf_size / handle->phys_mtu - 1;
+    if ( slots > hdlc_ll_rx_slots( handle ) )
+    {
+        slots = hdlc_ll_rx_slots( handle );
+    }
+    return slots > held ? slots - held : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+bool hdlc_ll_rx_can_hold(hdlc_ll_handle_t handle)
+{
+    return hdlc_ll_rx_free_slots( handle ) > 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+int hdlc_ll_rx_hold(hdlc_ll_handle_t handle, const void *data)
+{
+    const uint8_t *ptr = (const uint8_t *)data;
+    if ( !handle || handle->rx_packed || ptr < handle->rx_buf || ptr >= handle->rx_buf + handle->rx_buf_size )
+    {
+        return TINY_ERR_INVALID_DATA;
+    }
+    uint32_t bit = hdlc_ll_rx_slot_bit( handle, ptr );
+    if ( handle->rx_hold_mask & bit )
+    {
+        return TINY_ERR_INVALID_DATA;
+    }
+    if ( !bit || !hdlc_ll_rx_can_hold( handle ) )
+    {
+        return TINY_ERR_BUSY;
+    }
+    handle->rx_hold_mask |= bit;
+    return TINY_SUCCESS;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////
+
+int hdlc_ll_rx_release(hdlc_ll_handle_t handle, const void *data)
+{
+    const uint8_t *ptr = (const uint8_t *)data;
+    if ( !handle || ptr < handle->rx_buf || ptr >= handle->rx_buf + handle->rx_buf_size )
+    {
+        return TINY_ERR_INVALID_DATA;
+    }
+    uint32_t bit = hdlc_ll_rx_slot_bit( handle, ptr );
+    if ( !(handle->rx_hold_mask & bit) )
+    {
+        return TINY_ERR_INVALID_DATA;
+    }
+    handle->rx_hold_mask &= ~bit;
+    return TINY_SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+int hdlc_ll_get_stats(hdlc_ll_handle_t handle, hdlc_ll_stats_t *stats)
+{
+    if ( !handle || !stats )
+    {
+        return TINY_ERR_INVALID_DATA;
+    }
+    *stats = handle->stats;
+    return TINY_SUCCESS;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////
+
+void hdlc_ll_reset_stats(hdlc_ll_handle_t handle)
+{
+    memset(&handle->stats, 0, sizeof(handle->stats));
+}
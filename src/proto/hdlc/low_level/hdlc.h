@@ -71,6 +71,33 @@ extern "C"
         HDLC_LL_RESET_RX_ONLY = 0x02,
     } hdlc_ll_reset_flags_t;
 
+    /**
+     * Framing options, supported by hdlc low level
+     */
+    typedef enum
+    {
+        HDLC_FRAMING_HDLC = 0,   ///< RFC 1662 byte stuffing: 0x7E flags, 0x7D escape char (default)
+        HDLC_FRAMING_COBS = 1,   ///< COBS encoded frames delimited by 0x00, overhead is 1 byte per 254 bytes
+        HDLC_FRAMING_LENGTH = 2, ///< 0x7E marker, 16-bit little-endian length and raw data. For reliable streams only
+    } hdlc_framing_t;
+
+    /**
+     * Statistics counters of hdlc low level instance. Counters are always enabled,
+     * they are updated from hdlc_ll_run_rx() and hdlc_ll_run_tx() contexts and wrap around on overflow.
+     */
+    typedef struct
+    {
+        uint32_t rx_frames;          ///< Number of frames received with valid crc
+        uint32_t rx_bytes;           ///< Number of payload bytes in received valid frames
+        uint32_t rx_crc_errors;      ///< Number of frames, rejected because of wrong crc
+        uint32_t rx_oversize_frames; ///< Number of frames, which did not fit mtu
+        uint32_t rx_resyncs;         ///< Number of times receiver lost frame alignment and searched for the next frame
+        uint32_t rx_discarded_bytes; ///< Number of bytes, discarded by receiver while searching for the frame start
+        uint32_t tx_frames;          ///< Number of frames sent
+        uint32_t tx_bytes;           ///< Number of payload bytes in sent frames
+        uint32_t tx_escapes;         ///< Number of escape chars inserted to tx stream by byte stuffing
+    } hdlc_ll_stats_t;
+
     struct hdlc_ll_data_t;
 
     /** Handle for HDLC low level protocol */
@@ -127,6 +154,35 @@ extern "C"
 
         /** mtu size, can be 0 */
         int mtu;
+
+        /**
+         * If true, consecutive frames, waiting in TX queue, share single 0x7E delimiter as
+         * RFC 1662 allows: closing flag of one frame is opening flag of the next one.
+         * Receiving side accepts such frames only if this option is enabled there too.
+         * Default is false.
+         */
+        bool shared_flag;
+
+        /**
+         * Number of frames, which can wait in TX queue behind the frame being sent.
+         * Queue is allocated from buf, use hdlc_ll_get_buf_size_ex2() to calculate the buffer size.
+         * Default is 0: hdlc_ll_put_frame() accepts single frame at a time.
+         */
+        uint8_t tx_queue_size;
+
+        /**
+         * Framing to use on the line. Both sides must use the same framing.
+         * HDLC_FRAMING_HDLC is used by default.
+         */
+        hdlc_framing_t framing;
+
+        /**
+         * If true, each received frame is placed in RX buffer right after the previous one instead
+         * of the next mtu-sized slot. RX buffer wraps, when the space left is less than mtu.
+         * The same buffer keeps more small frames valid after on_frame_read is called.
+         * Default is false.
+         */
+        bool rx_packed;
     } hdlc_ll_init_t;
 
     //------------------------ GENERIC FUNCTIONS ------------------------------
@@ -151,12 +207,22 @@ extern "C"
     /**
      * Resets hdlc state. Use this function, if hw error happened on tx or rx
      * line, and this requires hardware change, and cancelling current operation.
+     * Frame being sent and frames, waiting in TX queue, are returned to the user via on_frame_send
+     * callback in the order they were put, same as hdlc_ll_close() does.
      *
      * @param handle hdlc handle
      * @param flags HDLC_LL_RESET_TX_ONLY, HDLC_LL_RESET_RX_ONLY, HDLC_LL_RESET_BOTH
      */
     void hdlc_ll_reset(hdlc_ll_handle_t handle, uint8_t flags);
 
+    /**
+     * Returns frames, waiting in TX queue, to the user via on_frame_send callback.
+     * Frame being sent is not affected.
+     *
+     * @param handle hdlc handle
+     */
+    void hdlc_ll_tx_purge(hdlc_ll_handle_t handle);
+
     //------------------------ RX FUNCTIONS ------------------------------
 
     /**
@@ -190,6 +256,42 @@ extern "C"
      */
     int hdlc_ll_run_rx(hdlc_ll_handle_t handle, const void *data, int len, int *error);
 
+    /**
+     * Keeps received frame valid after on_frame_read callback returns. RX buffer slot with the frame
+     * is not used for new frames until hdlc_ll_rx_release() is called. At least one slot always stays
+     * free for receiving. Holding is not supported in rx_packed mode, and only first 32 RX slots can be held.
+     *
+     * @param handle hdlc handle
+     * @param data pointer to the received frame, passed to on_frame_read callback
+     * @return TINY_SUCCESS if frame is held
+     *         TINY_ERR_BUSY if there are no more RX slots to hold
+     *         TINY_ERR_INVALID_DATA if data doesn't point to RX slot, or slot is already held
+     */
+    int hdlc_ll_rx_hold(hdlc_ll_handle_t handle, const void *data);
+
+    /**
+     * Returns RX buffer slot, held by hdlc_ll_rx_hold(), for receiving new frames.
+     *
+     * @param handle hdlc handle
+     * @param data pointer to the held frame
+     * @return TINY_SUCCESS or TINY_ERR_INVALID_DATA if frame is not held
+     */
+    int hdlc_ll_rx_release(hdlc_ll_handle_t handle, const void *data);
+
+    /**
+     * Returns true if one more received frame can be held by hdlc_ll_rx_hold().
+     *
+     * @param handle hdlc handle
+     */
+    bool hdlc_ll_rx_can_hold(hdlc_ll_handle_t handle);
+
+    /**
+     * Returns number of RX slots, which still can be held by hdlc_ll_rx_hold().
+     *
+     * @param handle hdlc handle
+     */
+    int hdlc_ll_rx_free_slots(hdlc_ll_handle_t handle);
+
     //------------------------ TX FUNCTIONS ------------------------------
 
     /**
@@ -235,6 +337,8 @@ extern "C"
      * hdlc_ll_put_frame() function will not wait or perform send operation, but only pass data pointer to
      * hdlc state machine. In this case, some other thread needs to
      * or in the same thread you need to send data using hdlc_ll_run_tx().
+     * If another frame is being sent, new frame is put to TX queue (up to tx_queue_size
+     * frames, see hdlc_ll_init_t), and hdlc_ll_run_tx() sends queued frames back-to-back.
      *
      * @param handle hdlc handle
      * @param data pointer to new data to send
@@ -274,6 +378,36 @@ extern "C"
      */
     int hdlc_ll_get_buf_size_ex(int mtu, hdlc_crc_t crc_type, int rx_window);
 
+    /**
+     * Returns minimum buffer size, required to hold hdlc low level data for desired payload size
+     * and TX queue.
+     *
+     * @param mtu size of desired max payload in bytes
+     * @param crc_type type of crc validation to use for the protocol
+     * @param rx_window number of RX frames in the RX ring buffer
+     * @param tx_queue_size number of frames in TX queue (refer to hdlc_ll_init_t)
+     *
+     * @return size of the buffer required
+     */
+    int hdlc_ll_get_buf_size_ex2(int mtu, hdlc_crc_t crc_type, int rx_window, int tx_queue_size);
+
+    /**
+     * Copies statistics counters of hdlc low level instance.
+     *
+     * @param handle hdlc handle
+     * @param stats pointer to structure to fill with counters
+     * @return TINY_ERR_INVALID_DATA if handle or stats is NULL.
+     *         TINY_SUCCESS if counters are copied
+     */
+    int hdlc_ll_get_stats(hdlc_ll_handle_t handle, hdlc_ll_stats_t *stats);
+
+    /**
+     * Clears statistics counters of hdlc low level instance.
+     *
+     * @param handle hdlc handle
+     */
+    void hdlc_ll_reset_stats(hdlc_ll_handle_t handle);
+
     /**
      * @}
      */
@@ -57,6 +57,18 @@ extern "C"
  */
 #define HDLC_BUF_SIZE_EX(mtu, crc, window) (sizeof(hdlc_ll_data_t) + ((int)(crc) / 8 + (mtu)) * (window) + TINY_ALIGN_STRUCT_VALUE - 1)
 
+/**
+ * Macro calculating additional buffer size required for TX queue of specified number of frames
+ */
+#define HDLC_TX_QUEUE_BUF_SIZE(frames) (sizeof(hdlc_ll_tx_frame_t) * (frames))
+
+    /** Descriptor of the frame, waiting in TX queue */
+    typedef struct
+    {
+        const uint8_t *data;
+        int len;
+    } hdlc_ll_tx_frame_t;
+
     /**
      * Structure describes configuration of lowest HDLC level
      * Initialize this structure by 0 before passing to hdlc_ll_init()
@@ -104,17 +116,37 @@ extern "C"
         /** User data, which will be passed to user-defined callback as first argument */
         void *user_data;
 
+        /** Statistics counters, see hdlc_ll_get_stats() */
+        hdlc_ll_stats_t stats;
+
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
         /** Parameters in DOXYGEN_SHOULD_SKIP_THIS section should not be modified by a user */
         int phys_mtu;
+        bool shared_flag;
+        bool rx_packed;
+        uint8_t framing;
+        uint32_t rx_hold_mask; // mtu-sized RX slots, held by the user with hdlc_ll_rx_hold()
         struct
         {
             int (*state)(hdlc_ll_handle_t handle, const uint8_t *data, int len);
             // pointer to the next byte in frame buffer
             uint8_t *ptr;
+            // running crc of the frame being received
+            crc_t crc;
+            // HDLC: escape char received, COBS: zero byte is pending at the end of the block
             uint8_t escape;
+            // COBS: bytes left in the current block, LENGTH: number of header bytes received
+            uint8_t block;
+            // frame bytes were dropped, because the frame doesn't fit mtu
+            uint8_t overflow;
+            // non-fill bytes were discarded while searching for the frame start
+            uint8_t lost_sync;
+            // LENGTH: number of frame bytes left to receive
+            uint16_t frame_len;
             // pointer to the start of the frame buffer
             uint8_t *active_frame_buf;
+            // pointer to the first byte not yet included to crc
+            uint8_t *crc_ptr;
         } rx;
 
         struct
@@ -127,6 +159,18 @@ extern "C"
             int len;
             crc_t crc;
             uint8_t escape;
+            // opening flag of current frame is closing flag of the previous one
+            uint8_t skip_flag;
+            uint8_t queue_size;
+            uint8_t queue_head;
+            // frames waiting behind the frame being sent are located right after this structure
+            uint8_t queue_count;
+            // COBS: bytes left in the current block, LENGTH: number of header bytes sent
+            uint8_t block;
+            // COBS: code of the current block
+            uint8_t code;
+            // COBS, LENGTH: crc bytes left to send
+            uint8_t crc_left;
         } tx;
 #endif
     } hdlc_ll_data_t;
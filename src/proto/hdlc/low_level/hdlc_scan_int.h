@@ -0,0 +1,154 @@
+/*
+    Copyright 2026 (C) Alexey Dynda
+
+    This file is part of Tiny Protocol Library.
+
+    GNU General Public License Usage
+
+    Protocol Library is free software: you can redistribute it and/or modify
+    it under the terms of the GNU Lesser General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    Protocol Library is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with Protocol Library.  If not, see <http://www.gnu.org/licenses/>.
+
+    Commercial License Usage
+
+    Licensees holding valid commercial Tiny Protocol licenses may use this file in
+    accordance with the commercial license agreement provided in accordance with
+    the terms contained in a written agreement between you and Alexey Dynda.
+    For further information contact via email on github account.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#define HDLC_SCAN_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define HDLC_SCAN_NEON 1
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+static inline int __hdlc_ctz(uint32_t value)
+{
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return (int)index;
+}
+#else
+#define __hdlc_ctz(value) __builtin_ctz(value)
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @ingroup HDLC_LOW_LEVEL_API
+ * @{
+ *
+ * @brief vectorized search of HDLC special bytes
+ *
+ * @details Internal helpers used by the block encoder and decoder to find the next
+ *          0x7E (flag) or 0x7D (escape) byte in a data block. The implementation is selected
+ *          at build time: SSE2/AVX2 on x86, NEON on AArch64, and word-at-a-time scan on
+ *          other platforms. AVR uses plain byte loop.
+ */
+
+#define HDLC_SCAN_FLAG 0x7E
+#define HDLC_SCAN_ESCAPE 0x7D
+
+    /**
+     * Returns index of the first 0x7E or 0x7D byte in the block, or len if the block
+     * contains none of them.
+     *
+     * @param data pointer to the data block
+     * @param len size of the data block in bytes
+     * @return index of the first special byte or len
+     */
+    static inline int hdlc_scan_special(const uint8_t *data, int len)
+    {
+        int pos = 0;
+#if defined(__AVX2__)
+        const __m256i flag32 = _mm256_set1_epi8((char)HDLC_SCAN_FLAG);
+        const __m256i escape32 = _mm256_set1_epi8((char)HDLC_SCAN_ESCAPE);
+        for ( ; pos + 32 <= len; pos += 32 )
+        {
+            __m256i block = _mm256_loadu_si256((const __m256i *)(data + pos));
+            uint32_t mask = (uint32_t)_mm256_movemask_epi8(
+                _mm256_or_si256(_mm256_cmpeq_epi8(block, flag32), _mm256_cmpeq_epi8(block, escape32)));
+            if ( mask )
+            {
+                return pos + __hdlc_ctz(mask);
+            }
+        }
+#endif
+#if defined(HDLC_SCAN_SSE2)
+        const __m128i flag16 = _mm_set1_epi8((char)HDLC_SCAN_FLAG);
+        const __m128i escape16 = _mm_set1_epi8((char)HDLC_SCAN_ESCAPE);
+        for ( ; pos + 16 <= len; pos += 16 )
+        {
+            __m128i block = _mm_loadu_si128((const __m128i *)(data + pos));
+            uint32_t mask = (uint32_t)_mm_movemask_epi8(
+                _mm_or_si128(_mm_cmpeq_epi8(block, flag16), _mm_cmpeq_epi8(block, escape16)));
+            if ( mask )
+            {
+                return pos + __hdlc_ctz(mask);
+            }
+        }
+#elif defined(HDLC_SCAN_NEON)
+        const uint8x16_t flag16 = vdupq_n_u8(HDLC_SCAN_FLAG);
+        const uint8x16_t escape16 = vdupq_n_u8(HDLC_SCAN_ESCAPE);
+        for ( ; pos + 16 <= len; pos += 16 )
+        {
+            uint8x16_t block = vld1q_u8(data + pos);
+            uint8x16_t eq = vorrq_u8(vceqq_u8(block, flag16), vceqq_u8(block, escape16));
+            // Narrow 16 compare results to 64-bit mask with 4 bits per byte
+            uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+            if ( mask )
+            {
+                return pos + (__builtin_ctzll(mask) >> 2);
+            }
+        }
+#elif !defined(__AVR__)
+        const uintptr_t ones = (uintptr_t)-1 / 0xFF;
+        const uintptr_t highs = ones << 7;
+        for ( ; pos + (int)sizeof(uintptr_t) <= len; pos += sizeof(uintptr_t) )
+        {
+            uintptr_t word;
+            memcpy(&word, data + pos, sizeof(word));
+            uintptr_t flag = word ^ (ones * HDLC_SCAN_FLAG);
+            uintptr_t escape = word ^ (ones * HDLC_SCAN_ESCAPE);
+            if ( (((flag - ones) & ~flag) | ((escape - ones) & ~escape)) & highs )
+            {
+                break;
+            }
+        }
+#endif
+        while ( pos < len && data[pos] != HDLC_SCAN_FLAG && data[pos] != HDLC_SCAN_ESCAPE )
+        {
+            pos++;
+        }
+        return pos;
+    }
+
+    /**
+     * @}
+     */
+
+#ifdef __cplusplus
+}
+#endif
@@ -76,6 +76,8 @@ int tiny_light_init(STinyLightData *handle, write_block_cb_t write_func, read_bl
     init.buf = &handle->buffer[0];
     init.buf_size = LIGHT_BUF_SIZE;
     init.crc_type = ((STinyLightData *)handle)->crc_type;
+    init.framing = handle->framing;
+    init.shared_flag = handle->shared_flag;
 
     handle->user_data = pdata;
     handle->read_func = read_func;
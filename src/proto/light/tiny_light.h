@@ -36,6 +36,7 @@
 #define _TINY_LIGHT_H_
 
 #include "proto/hdlc/low_level/hdlc.h"
+#include "proto/hdlc/low_level/hdlc_int.h"
 #include "hal/tiny_types.h"
 
 #ifdef __cplusplus
@@ -72,7 +73,7 @@ extern "C"
 /**
  * This macro defines buffer size required for tiny light protocol
  */
-#define LIGHT_BUF_SIZE (sizeof(uintptr_t) * 18)
+#define LIGHT_BUF_SIZE HDLC_MIN_BUF_SIZE(0, HDLC_CRC_DEFAULT)
 
     /**
      * This structure contains information about communication channel and its state.
@@ -93,6 +94,10 @@ extern "C"
         void *user_data;
         /// CRC type to use
         hdlc_crc_t crc_type;
+        /// Framing to use, HDLC_FRAMING_HDLC by default
+        hdlc_framing_t framing;
+        /// Accept frames, sharing single 0x7E flag with the previous frame, false by default
+        bool shared_flag;
     } STinyLightData;
 
     /**
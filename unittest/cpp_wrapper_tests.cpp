@@ -324,6 +324,29 @@ TEST(CPP_FD, RunTxGeneratesData)
     fd.end();
 }
 
+TEST(CPP_FD, ReserveAndCommitPacket)
+{
+    tinyproto::FdD fd(1024);
+    fd.disableCrc();
+    fd.setWindowSize(2);
+    fd.begin();
+    // Remote side establishes connection with SABM
+    fd.run_rx("\x7E\x03\x2F\x7E", 4);
+    uint8_t tx_buf[64];
+    CHECK_EQUAL(4, fd.run_tx(tx_buf, sizeof(tx_buf))); // UA
+
+    tinyproto::IPacket pkt;
+    CHECK_EQUAL(TINY_SUCCESS, fd.reserve(pkt, 8));
+    CHECK_EQUAL(8, pkt.maxSize());
+    pkt.put('Z');
+    CHECK_EQUAL(TINY_SUCCESS, fd.commit(pkt));
+    int tx_len = fd.run_tx(tx_buf, sizeof(tx_buf));
+    CHECK_EQUAL(5, tx_len);
+    CHECK_EQUAL('Z', tx_buf[3]);
+
+    fd.end();
+}
+
 TEST(CPP_FD, RunTxCallbackBreaksOnZeroWrite)
 {
     tinyproto::FdD fd(1024);
@@ -405,6 +428,9 @@ TEST(CPP_FD, CrcModes)
     CHECK(fd.enableCheckSum());
     CHECK(fd.enableCrc16());
     CHECK(fd.enableCrc32());
+    CHECK(fd.enableCrc32c());
+    CHECK_EQUAL(tiny_fd_buffer_size_by_mtu_ex(1, 64, 4, HDLC_CRC_32, 3),
+                tiny_fd_buffer_size_by_mtu_ex(1, 64, 4, HDLC_CRC_32C, 3));
     fd.disableCrc();
     fd.begin();
     fd.end();
@@ -32,8 +32,10 @@
 #include <stdio.h>
 #include <string.h>
 #include <thread>
+#include <vector>
 #include "helpers/tiny_fd_helper.h"
 #include "helpers/fake_connection.h"
+#include "proto/fd/tiny_fd_int.h"
 
 TEST_GROUP(FD)
 {
@@ -72,6 +74,68 @@ TEST(FD, multithread_basic_test)
     CHECK_EQUAL(200, helper1.rx_count());
 }
 
+TEST(FD, cobs_and_length_framing)
+{
+    const hdlc_framing_t framings[] = {HDLC_FRAMING_COBS, HDLC_FRAMING_LENGTH};
+    for ( auto framing : framings )
+    {
+        FakeSetup conn;
+        TinyHelperFd helper1(&conn.endpoint1(), 4096, TINY_FD_MODE_ABM, nullptr);
+        TinyHelperFd helper2(&conn.endpoint2(), 4096, TINY_FD_MODE_ABM, nullptr);
+        helper1.setTimeout(250);
+        helper1.setFraming(framing);
+        helper1.init();
+        helper2.setTimeout(250);
+        helper2.setFraming(framing);
+        helper2.init();
+        helper1.run(true);
+        helper2.run(true);
+
+        for ( int nsent = 0; nsent < 50; nsent++ )
+        {
+            uint8_t txbuf[6] = {0x00, 0x7E, 0x00, 0x7D, 0xFF, (uint8_t)nsent};
+            CHECK_EQUAL(TINY_SUCCESS, helper2.send(txbuf, sizeof(txbuf)));
+        }
+        helper1.wait_until_rx_count(50, 250);
+        CHECK_EQUAL(50, helper1.rx_count());
+    }
+}
+
+TEST(FD, small_tx_slots)
+{
+    // Small slots take only their payload from the buffer
+    CHECK_EQUAL(tiny_fd_buffer_size_by_mtu_ex(1, 256, 7, HDLC_CRC_16, 1) - 5 * (256 - 16),
+                tiny_fd_buffer_size_by_mtu_slab(1, 256, 7, HDLC_CRC_16, 1, 5, 16));
+
+    FakeSetup conn;
+    int corrupted = 0;
+    TinyHelperFd helper1(&conn.endpoint1(), 4096, TINY_FD_MODE_ABM,
+                         [&corrupted](uint8_t addr, uint8_t *buf, int len) -> void {
+                             if ( buf[0] != buf[len - 1] )
+                                 corrupted++;
+                         });
+    TinyHelperFd helper2(&conn.endpoint2(), 4096, TINY_FD_MODE_ABM, nullptr);
+    helper1.setTimeout(250);
+    helper1.init();
+    helper2.setTimeout(250);
+    helper2.setSmallFrames(5, 16);
+    CHECK_EQUAL(TINY_SUCCESS, helper2.init());
+    helper1.run(true);
+    helper2.run(true);
+
+    // Mix of long and short frames: long frames go to full-size slots, short ones mostly to small slots
+    for ( int nsent = 0; nsent < 60; nsent++ )
+    {
+        uint8_t txbuf[200];
+        int len = (nsent % 3) == 0 ? sizeof(txbuf) : 4;
+        memset(txbuf, nsent, len);
+        CHECK_EQUAL(TINY_SUCCESS, helper2.send(txbuf, len));
+    }
+    helper1.wait_until_rx_count(60, 250);
+    CHECK_EQUAL(60, helper1.rx_count());
+    CHECK_EQUAL(0, corrupted);
+}
+
 TEST(FD, multithread_read_test)
 {
     FakeSetup conn;
@@ -320,3 +384,130 @@ TEST(FD, on_connect_callback)
     }
     CHECK_EQUAL(false, connected);
 }
+
+TEST(FD, buffer_size_macros)
+{
+    CHECK((int)FD_MIN_BUF_SIZE(64, 4) >= tiny_fd_buffer_size_by_mtu(64, 4));
+    CHECK((int)FD_BUF_SIZE_EX(64, 7, HDLC_CRC_32, 3) >= tiny_fd_buffer_size_by_mtu_ex(1, 64, 7, HDLC_CRC_32, 3));
+    // Static buffer of FD_MIN_BUF_SIZE() bytes fits requested mtu and window
+    static uint8_t buffer[FD_MIN_BUF_SIZE(64, 4)];
+    tiny_fd_handle_t handle = nullptr;
+    tiny_fd_init_t init{};
+    init.on_read_cb = [](void *, uint8_t, uint8_t *, int) -> void {};
+    init.buffer = buffer;
+    init.buffer_size = sizeof(buffer);
+    init.mtu = 64;
+    init.window_frames = 4;
+    init.crc_type = HDLC_CRC_16;
+    init.send_timeout = 1000;
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_init(&handle, &init));
+    tiny_fd_close(handle);
+}
+
+TEST(FD, queue_allocates_slots_in_free_order)
+{
+    uint8_t buffer[128];
+    tiny_fd_queue_t queue;
+    CHECK(tiny_fd_queue_init(&queue, buffer, sizeof(buffer), 4, 8) > 0);
+    tiny_fd_frame_info_t *frames[4];
+    for ( uint8_t i = 0; i < 4; i++ )
+    {
+        frames[i] = tiny_fd_queue_allocate(&queue, TINY_FD_QUEUE_I_FRAME, &i, 1);
+        CHECK(frames[i] != nullptr);
+        CHECK_EQUAL(i, tiny_fd_queue_get_index(&queue, frames[i]));
+        CHECK_EQUAL(i, frames[i]->payload[0]);
+    }
+    // Exhausted queue
+    CHECK_FALSE(tiny_fd_queue_has_free_slots(&queue));
+    POINTERS_EQUAL(nullptr, tiny_fd_queue_allocate(&queue, TINY_FD_QUEUE_I_FRAME, nullptr, 1));
+    // Freed slots are reused in the order they are freed
+    tiny_fd_queue_free(&queue, frames[2]);
+    tiny_fd_queue_free(&queue, frames[0]);
+    tiny_fd_queue_free(&queue, frames[0]); // Double free is ignored
+    CHECK(tiny_fd_queue_has_free_slots(&queue));
+    POINTERS_EQUAL(frames[2], tiny_fd_queue_allocate(&queue, TINY_FD_QUEUE_I_FRAME, nullptr, 1));
+    POINTERS_EQUAL(frames[0], tiny_fd_queue_allocate(&queue, TINY_FD_QUEUE_I_FRAME, nullptr, 1));
+    POINTERS_EQUAL(nullptr, tiny_fd_queue_allocate(&queue, TINY_FD_QUEUE_I_FRAME, nullptr, 1));
+    // Too large frame
+    tiny_fd_queue_free(&queue, frames[1]);
+    POINTERS_EQUAL(nullptr, tiny_fd_queue_allocate(&queue, TINY_FD_QUEUE_I_FRAME, nullptr, 9));
+}
+
+TEST(FD, queue_small_slots_exhaustion)
+{
+    uint8_t buffer[128];
+    tiny_fd_queue_t queue;
+    CHECK(tiny_fd_queue_init_ex(&queue, buffer, sizeof(buffer), 4, 16, 2, 4) > 0);
+    // Small frames take small slots first
+    tiny_fd_frame_info_t *small1 = tiny_fd_queue_allocate(&queue, TINY_FD_QUEUE_I_FRAME, nullptr, 4);
+    tiny_fd_frame_info_t *small2 = tiny_fd_queue_allocate(&queue, TINY_FD_QUEUE_I_FRAME, nullptr, 2);
+    CHECK_EQUAL(2, tiny_fd_queue_get_index(&queue, small1));
+    CHECK_EQUAL(3, tiny_fd_queue_get_index(&queue, small2));
+    POINTERS_EQUAL(small2, tiny_fd_queue_get_by_index(&queue, 3));
+    // and full-size slots, when small ones are exhausted
+    tiny_fd_frame_info_t *large = tiny_fd_queue_allocate(&queue, TINY_FD_QUEUE_I_FRAME, nullptr, 4);
+    CHECK_EQUAL(0, tiny_fd_queue_get_index(&queue, large));
+    CHECK(tiny_fd_queue_allocate(&queue, TINY_FD_QUEUE_I_FRAME, nullptr, 16) != nullptr);
+    CHECK_FALSE(tiny_fd_queue_has_free_slots(&queue));
+    // Free small slot doesn't fit large frame
+    tiny_fd_queue_free(&queue, small1);
+    CHECK(tiny_fd_queue_has_free_slots_for(&queue, 4));
+    CHECK_FALSE(tiny_fd_queue_has_free_slots_for(&queue, 5));
+    POINTERS_EQUAL(nullptr, tiny_fd_queue_allocate(&queue, TINY_FD_QUEUE_I_FRAME, nullptr, 5));
+    POINTERS_EQUAL(small1, tiny_fd_queue_allocate(&queue, TINY_FD_QUEUE_I_FRAME, nullptr, 1));
+}
+
+TEST(FD, queue_reset_for_frees_only_peer_slots)
+{
+    uint8_t buffer[128];
+    tiny_fd_queue_t queue;
+    CHECK(tiny_fd_queue_init(&queue, buffer, sizeof(buffer), 4, 8) > 0);
+    const uint8_t addresses[4] = {0x07, 0x0B, 0x05, 0x07};
+    tiny_fd_frame_info_t *frames[4];
+    for ( int i = 0; i < 4; i++ )
+    {
+        frames[i] = tiny_fd_queue_allocate(&queue, i == 3 ? TINY_FD_QUEUE_RESERVED : TINY_FD_QUEUE_I_FRAME, nullptr, 1);
+        frames[i]->header.address = addresses[i];
+    }
+    // CR and E bits of the address are ignored, reserved slots stay allocated
+    tiny_fd_queue_reset_for(&queue, 0x05);
+    CHECK_EQUAL(TINY_FD_QUEUE_FREE, frames[0]->type);
+    CHECK_EQUAL(TINY_FD_QUEUE_I_FRAME, frames[1]->type);
+    CHECK_EQUAL(TINY_FD_QUEUE_FREE, frames[2]->type);
+    CHECK_EQUAL(TINY_FD_QUEUE_RESERVED, frames[3]->type);
+    POINTERS_EQUAL(frames[0], tiny_fd_queue_allocate(&queue, TINY_FD_QUEUE_I_FRAME, nullptr, 1));
+    POINTERS_EQUAL(frames[2], tiny_fd_queue_allocate(&queue, TINY_FD_QUEUE_I_FRAME, nullptr, 1));
+    POINTERS_EQUAL(nullptr, tiny_fd_queue_allocate(&queue, TINY_FD_QUEUE_I_FRAME, nullptr, 1));
+}
+
+TEST(FD, i_queue_slots_map_after_ns_wrap)
+{
+    std::vector<uint8_t> buffer(1024);
+    tiny_fd_handle_t handle = nullptr;
+    tiny_fd_init_t init{};
+    init.on_read_cb = [](void *, uint8_t, uint8_t *, int) -> void {};
+    init.buffer = buffer.data();
+    init.buffer_size = buffer.size();
+    init.mtu = 8;
+    init.window_frames = 3;
+    init.crc_type = HDLC_CRC_16;
+    init.send_timeout = 1000;
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_init(&handle, &init));
+    // Window of 3 frames is mapped by N(S) modulo 4, while N(S) wraps modulo 8
+    for ( uint8_t i = 0; i < 20; i++ )
+    {
+        CHECK(__put_i_frame_to_tx_queue(handle, 0, &i, 1));
+        if ( i < 2 )
+        {
+            continue;
+        }
+        const uint8_t ns = (i - 2) & HDLC_SEQ_MASK;
+        tiny_fd_frame_info_t *frame = __get_i_frame_from_tx_queue(handle, 0, ns);
+        CHECK(frame != nullptr);
+        CHECK_EQUAL(i - 2, frame->payload[0]);
+        CHECK_EQUAL(ns, (frame->header.control >> 1) & HDLC_SEQ_MASK);
+        __free_i_frame_from_tx_queue(handle, 0, ns);
+        POINTERS_EQUAL(nullptr, __get_i_frame_from_tx_queue(handle, 0, ns));
+    }
+    tiny_fd_close(handle);
+}
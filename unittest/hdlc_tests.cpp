@@ -26,11 +26,13 @@
     For further information contact via email on github account.
 */
 
+#include <algorithm>
 #include <functional>
 #include <CppUTest/TestHarness.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <vector>
 #include "helpers/tiny_hdlc_helper.h"
 #include "helpers/fake_connection.h"
 #include <TinyProtocolHdlc.h>
@@ -308,3 +310,579 @@ TEST(HDLC, check_buf_size_calculations)
     CHECK_EQUAL( sizeof(hdlc_ll_data_t) + 11 + TINY_ALIGN_STRUCT_VALUE, hdlc_ll_get_buf_size_ex(10, HDLC_CRC_16, 1) );
     CHECK_EQUAL( sizeof(hdlc_ll_data_t) + 13 + TINY_ALIGN_STRUCT_VALUE, hdlc_ll_get_buf_size_ex(10, HDLC_CRC_32, 1) );
 }
+
+static int hdlc_encode_frame(hdlc_crc_t crc, const uint8_t *frame, int frame_len, uint8_t *out, int out_len, int chunk,
+                             hdlc_framing_t framing = HDLC_FRAMING_HDLC)
+{
+    uint8_t buffer[512];
+    hdlc_ll_handle_t handle = nullptr;
+    hdlc_ll_init_t init{};
+    init.buf = buffer;
+    init.buf_size = sizeof(buffer);
+    init.crc_type = crc;
+    init.mtu = 64;
+    init.framing = framing;
+    if ( hdlc_ll_init(&handle, &init) != TINY_SUCCESS )
+    {
+        return -1;
+    }
+    hdlc_ll_put_frame(handle, frame, frame_len);
+    int total = 0;
+    while ( total < out_len )
+    {
+        int len = hdlc_ll_run_tx(handle, out + total, chunk < out_len - total ? chunk : out_len - total);
+        if ( len <= 0 )
+        {
+            break;
+        }
+        total += len;
+    }
+    hdlc_ll_close(handle);
+    return total;
+}
+
+TEST(HDLC, hdlc_block_encode_matches_byte_encode)
+{
+    const hdlc_crc_t crcs[] = {HDLC_CRC_OFF, HDLC_CRC_8, HDLC_CRC_16, HDLC_CRC_32, HDLC_CRC_32C};
+    srand(1);
+    for ( int iter = 0; iter < 200; iter++ )
+    {
+        uint8_t frame[64];
+        int frame_len = 1 + rand() % sizeof(frame);
+        for ( int i = 0; i < frame_len; i++ )
+        {
+            // Make frames rich of bytes, which need escaping
+            int r = rand() % 4;
+            frame[i] = r == 0 ? 0x7E : r == 1 ? 0x7D : (uint8_t)rand();
+        }
+        for ( auto crc : crcs )
+        {
+            uint8_t block[256]{};
+            uint8_t bytes[256]{};
+            int block_len = hdlc_encode_frame(crc, frame, frame_len, block, sizeof(block), sizeof(block));
+            int bytes_len = hdlc_encode_frame(crc, frame, frame_len, bytes, sizeof(bytes), 1);
+            CHECK(block_len > frame_len);
+            CHECK_EQUAL(bytes_len, block_len);
+            MEMCMP_EQUAL(bytes, block, block_len);
+        }
+    }
+}
+
+struct HdlcRxResult
+{
+    uint8_t frames[8][640];
+    int lens[8];
+    int count;
+    int errors;
+};
+
+static void hdlc_on_test_frame_read(void *user_data, uint8_t *data, int len)
+{
+    HdlcRxResult *result = static_cast<HdlcRxResult *>(user_data);
+    if ( result->count < 8 )
+    {
+        memcpy(result->frames[result->count], data, len);
+        result->lens[result->count] = len;
+    }
+    result->count++;
+}
+
+static void hdlc_decode_stream(hdlc_crc_t crc, const uint8_t *stream, int stream_len, int chunk, HdlcRxResult &result,
+                               hdlc_framing_t framing = HDLC_FRAMING_HDLC, int mtu = 64)
+{
+    uint8_t buffer[2048];
+    hdlc_ll_handle_t handle = nullptr;
+    hdlc_ll_init_t init{};
+    init.buf = buffer;
+    init.buf_size = sizeof(buffer);
+    init.crc_type = crc;
+    init.mtu = mtu;
+    init.framing = framing;
+    init.on_frame_read = hdlc_on_test_frame_read;
+    init.user_data = &result;
+    memset(&result, 0, sizeof(result));
+    CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_init(&handle, &init));
+    int pos = 0;
+    while ( pos < stream_len )
+    {
+        int error = TINY_SUCCESS;
+        int len = chunk < stream_len - pos ? chunk : stream_len - pos;
+        pos += hdlc_ll_run_rx(handle, stream + pos, len, &error);
+        if ( error != TINY_SUCCESS )
+        {
+            result.errors++;
+        }
+    }
+    hdlc_ll_close(handle);
+}
+
+TEST(HDLC, hdlc_bulk_decode_matches_byte_decode)
+{
+    const hdlc_crc_t crcs[] = {HDLC_CRC_OFF, HDLC_CRC_8, HDLC_CRC_16, HDLC_CRC_32, HDLC_CRC_32C};
+    srand(2);
+    for ( int iter = 0; iter < 100; iter++ )
+    {
+        for ( auto crc : crcs )
+        {
+            uint8_t frames[3][64];
+            int lens[3];
+            uint8_t stream[3 * 256];
+            int stream_len = 0;
+            for ( int n = 0; n < 3; n++ )
+            {
+                lens[n] = 1 + rand() % sizeof(frames[n]);
+                for ( int i = 0; i < lens[n]; i++ )
+                {
+                    int r = rand() % 4;
+                    frames[n][i] = r == 0 ? 0x7E : r == 1 ? 0x7D : (uint8_t)rand();
+                }
+                stream_len += hdlc_encode_frame(crc, frames[n], lens[n], stream + stream_len, 256, 256);
+            }
+            HdlcRxResult bulk, bytes;
+            hdlc_decode_stream(crc, stream, stream_len, stream_len, bulk);
+            hdlc_decode_stream(crc, stream, stream_len, 1, bytes);
+            CHECK_EQUAL(3, bulk.count);
+            CHECK_EQUAL(3, bytes.count);
+            CHECK_EQUAL(0, bulk.errors);
+            for ( int n = 0; n < 3; n++ )
+            {
+                CHECK_EQUAL(lens[n], bulk.lens[n]);
+                CHECK_EQUAL(lens[n], bytes.lens[n]);
+                MEMCMP_EQUAL(frames[n], bulk.frames[n], lens[n]);
+                MEMCMP_EQUAL(frames[n], bytes.frames[n], lens[n]);
+            }
+        }
+    }
+}
+
+TEST(HDLC, hdlc_bulk_decode_too_long_frame)
+{
+    uint8_t stream[2 + 100];
+    stream[0] = 0x7E;
+    for ( int i = 1; i <= 100; i++ )
+    {
+        stream[i] = (uint8_t)i;
+    }
+    stream[101] = 0x7E;
+    HdlcRxResult bulk, bytes;
+    hdlc_decode_stream(HDLC_CRC_OFF, stream, sizeof(stream), sizeof(stream), bulk);
+    hdlc_decode_stream(HDLC_CRC_OFF, stream, sizeof(stream), 1, bytes);
+    CHECK_EQUAL(bytes.count, bulk.count);
+    CHECK_EQUAL(bytes.errors, bulk.errors);
+    CHECK_EQUAL(1, bulk.count);
+    CHECK_EQUAL(bytes.lens[0], bulk.lens[0]);
+    CHECK(bulk.lens[0] < 100);
+    MEMCMP_EQUAL(stream + 1, bulk.frames[0], bulk.lens[0]);
+}
+
+TEST(HDLC, hdlc_tx_queue_shared_flag)
+{
+    uint8_t buffer[512];
+    int sent_count = 0;
+    hdlc_ll_handle_t handle = nullptr;
+    hdlc_ll_init_t init{};
+    init.buf = buffer;
+    init.buf_size = sizeof(buffer);
+    init.crc_type = HDLC_CRC_16;
+    init.mtu = 64;
+    init.shared_flag = true;
+    init.tx_queue_size = 2;
+    init.user_data = &sent_count;
+    init.on_frame_send = [](void *user_data, const uint8_t *, int) -> void { (*static_cast<int *>(user_data))++; };
+    CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_init(&handle, &init));
+    const uint8_t frame1[] = {0x01, 0x02, 0x7E};
+    const uint8_t frame2[] = {0x7D, 0x04};
+    const uint8_t frame3[] = {0xFF, 0x05, 0x06};
+    CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_put_frame(handle, frame1, sizeof(frame1)));
+    CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_put_frame(handle, frame2, sizeof(frame2)));
+    CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_put_frame(handle, frame3, sizeof(frame3)));
+    CHECK_EQUAL(TINY_ERR_BUSY, hdlc_ll_put_frame(handle, frame3, sizeof(frame3)));
+
+    uint8_t stream[128];
+    int len = hdlc_ll_run_tx(handle, stream, sizeof(stream));
+    CHECK_EQUAL(3, sent_count);
+    // Frames 1 and 2 share the flag, frame 3 starts with fill byte and has its own opening flag
+    int flags = 0;
+    for ( int i = 0; i < len; i++ )
+    {
+        flags += stream[i] == 0x7E;
+    }
+    CHECK_EQUAL(5, flags);
+    CHECK_EQUAL(0x7E, stream[len - 1]);
+
+    HdlcRxResult result{};
+    init.on_frame_read = hdlc_on_test_frame_read;
+    init.on_frame_send = nullptr;
+    init.user_data = &result;
+    CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_init(&handle, &init));
+    int pos = 0;
+    while ( pos < len )
+    {
+        int error = TINY_SUCCESS;
+        pos += hdlc_ll_run_rx(handle, stream + pos, len - pos, &error);
+        CHECK_EQUAL(TINY_SUCCESS, error);
+    }
+    CHECK_EQUAL(3, result.count);
+    CHECK_EQUAL(sizeof(frame1), result.lens[0]);
+    CHECK_EQUAL(sizeof(frame2), result.lens[1]);
+    CHECK_EQUAL(sizeof(frame3), result.lens[2]);
+    MEMCMP_EQUAL(frame1, result.frames[0], sizeof(frame1));
+    MEMCMP_EQUAL(frame2, result.frames[1], sizeof(frame2));
+    MEMCMP_EQUAL(frame3, result.frames[2], sizeof(frame3));
+}
+
+TEST(HDLC, hdlc_tx_queue_returned_on_close)
+{
+    uint8_t buffer[512];
+    int sent_count = 0;
+    hdlc_ll_handle_t handle = nullptr;
+    hdlc_ll_init_t init{};
+    init.buf = buffer;
+    init.buf_size = sizeof(buffer);
+    init.crc_type = HDLC_CRC_16;
+    init.tx_queue_size = 3;
+    init.user_data = &sent_count;
+    init.on_frame_send = [](void *user_data, const uint8_t *, int) -> void { (*static_cast<int *>(user_data))++; };
+    CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_init(&handle, &init));
+    const uint8_t frame[] = {0x01, 0x02, 0x03};
+    for ( int i = 0; i < 4; i++ )
+    {
+        CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_put_frame(handle, frame, sizeof(frame)));
+    }
+    uint8_t stream[4];
+    hdlc_ll_run_tx(handle, stream, sizeof(stream));
+    CHECK_EQUAL(0, sent_count);
+    hdlc_ll_close(handle);
+    CHECK_EQUAL(4, sent_count);
+}
+
+TEST(HDLC, hdlc_tx_queue_returned_on_reset)
+{
+    uint8_t buffer[512];
+    int sent_count = 0;
+    hdlc_ll_handle_t handle = nullptr;
+    hdlc_ll_init_t init{};
+    init.buf = buffer;
+    init.buf_size = hdlc_ll_get_buf_size_ex2(16, HDLC_CRC_16, 2, 3);
+    init.crc_type = HDLC_CRC_16;
+    init.mtu = 16;
+    init.tx_queue_size = 3;
+    init.user_data = &sent_count;
+    init.on_frame_send = [](void *user_data, const uint8_t *, int) -> void { (*static_cast<int *>(user_data))++; };
+    CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_init(&handle, &init));
+    // Queue doesn't take RX space, requested by the buffer size
+    CHECK(handle->rx_buf_size >= 2 * (16 + 2));
+    const uint8_t frame[] = {0x01, 0x02, 0x03};
+    for ( int i = 0; i < 4; i++ )
+    {
+        CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_put_frame(handle, frame, sizeof(frame)));
+    }
+    // Frame being sent is dropped, and it is returned to the user together with queued frames
+    hdlc_ll_reset(handle, HDLC_LL_RESET_TX_ONLY);
+    CHECK_EQUAL(4, sent_count);
+    CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_put_frame(handle, frame, sizeof(frame)));
+    uint8_t stream[16];
+    CHECK(hdlc_ll_run_tx(handle, stream, sizeof(stream)) > 0);
+    CHECK_EQUAL(5, sent_count);
+    // Nothing is in progress
+    hdlc_ll_reset(handle, HDLC_LL_RESET_TX_ONLY);
+    CHECK_EQUAL(5, sent_count);
+}
+
+TEST(HDLC, cobs_encode)
+{
+    const uint8_t frame[] = {0x11, 0x22, 0x00, 0x33};
+    const uint8_t expected[] = {0x00, 0x03, 0x11, 0x22, 0x02, 0x33, 0x00};
+    uint8_t block[32]{};
+    uint8_t bytes[32]{};
+    int block_len = hdlc_encode_frame(HDLC_CRC_OFF, frame, sizeof(frame), block, sizeof(block), sizeof(block), HDLC_FRAMING_COBS);
+    int bytes_len = hdlc_encode_frame(HDLC_CRC_OFF, frame, sizeof(frame), bytes, sizeof(bytes), 1, HDLC_FRAMING_COBS);
+    CHECK_EQUAL(sizeof(expected), block_len);
+    CHECK_EQUAL(sizeof(expected), bytes_len);
+    MEMCMP_EQUAL(expected, block, sizeof(expected));
+    MEMCMP_EQUAL(expected, bytes, sizeof(expected));
+
+    const uint8_t trailing_zero[] = {0x11, 0x00};
+    const uint8_t expected_trailing_zero[] = {0x00, 0x02, 0x11, 0x01, 0x00};
+    block_len = hdlc_encode_frame(HDLC_CRC_OFF, trailing_zero, sizeof(trailing_zero), block, sizeof(block), sizeof(block),
+                                  HDLC_FRAMING_COBS);
+    CHECK_EQUAL(sizeof(expected_trailing_zero), block_len);
+    MEMCMP_EQUAL(expected_trailing_zero, block, sizeof(expected_trailing_zero));
+}
+
+TEST(HDLC, length_prefixed_encode)
+{
+    const uint8_t frame[] = {0x7E, 0x7D, 0x00};
+    const uint8_t expected[] = {0x7E, 0x03, 0x00, 0x7E, 0x7D, 0x00};
+    uint8_t bytes[32]{};
+    int bytes_len = hdlc_encode_frame(HDLC_CRC_OFF, frame, sizeof(frame), bytes, sizeof(bytes), 1, HDLC_FRAMING_LENGTH);
+    CHECK_EQUAL(sizeof(expected), bytes_len);
+    MEMCMP_EQUAL(expected, bytes, sizeof(expected));
+}
+
+TEST(HDLC, cobs_and_length_framing_round_trip)
+{
+    const hdlc_crc_t crcs[] = {HDLC_CRC_OFF, HDLC_CRC_8, HDLC_CRC_16, HDLC_CRC_32, HDLC_CRC_32C};
+    const hdlc_framing_t framings[] = {HDLC_FRAMING_COBS, HDLC_FRAMING_LENGTH};
+    srand(3);
+    for ( int iter = 0; iter < 50; iter++ )
+    {
+        for ( auto framing : framings )
+        {
+            for ( auto crc : crcs )
+            {
+                static uint8_t frames[3][600];
+                int lens[3];
+                static uint8_t stream[3 * 700];
+                int stream_len = 0;
+                for ( int n = 0; n < 3; n++ )
+                {
+                    lens[n] = 1 + rand() % sizeof(frames[n]);
+                    for ( int i = 0; i < lens[n]; i++ )
+                    {
+                        // Long runs of non-zero bytes check COBS blocks of maximum size
+                        int r = rand() % (iter & 1 ? 300 : 4);
+                        frames[n][i] = r == 0 ? 0x00 : r == 1 ? 0x7E : (uint8_t)(1 + rand() % 255);
+                    }
+                    uint8_t bytes[700];
+                    int len = hdlc_encode_frame(crc, frames[n], lens[n], stream + stream_len, 700, 700, framing);
+                    CHECK_EQUAL(len, hdlc_encode_frame(crc, frames[n], lens[n], bytes, 700, 1, framing));
+                    MEMCMP_EQUAL(bytes, stream + stream_len, len);
+                    stream_len += len;
+                }
+                static HdlcRxResult bulk, bytes;
+                hdlc_decode_stream(crc, stream, stream_len, stream_len, bulk, framing, 600);
+                hdlc_decode_stream(crc, stream, stream_len, 1, bytes, framing, 600);
+                CHECK_EQUAL(3, bulk.count);
+                CHECK_EQUAL(3, bytes.count);
+                CHECK_EQUAL(0, bulk.errors);
+                CHECK_EQUAL(0, bytes.errors);
+                for ( int n = 0; n < 3; n++ )
+                {
+                    CHECK_EQUAL(lens[n], bulk.lens[n]);
+                    CHECK_EQUAL(lens[n], bytes.lens[n]);
+                    MEMCMP_EQUAL(frames[n], bulk.frames[n], lens[n]);
+                    MEMCMP_EQUAL(frames[n], bytes.frames[n], lens[n]);
+                }
+            }
+        }
+    }
+}
+
+TEST(HDLC, cobs_resync_after_noise)
+{
+    const uint8_t frame[] = {0x01, 0x00, 0x02};
+    uint8_t stream[64] = {0x55, 0x13, 0x77};
+    int stream_len = 3;
+    stream_len += hdlc_encode_frame(HDLC_CRC_16, frame, sizeof(frame), stream + stream_len, 32, 32, HDLC_FRAMING_COBS);
+    HdlcRxResult result;
+    hdlc_decode_stream(HDLC_CRC_16, stream, stream_len, stream_len, result, HDLC_FRAMING_COBS);
+    CHECK_EQUAL(1, result.count);
+    CHECK_EQUAL(sizeof(frame), result.lens[0]);
+    MEMCMP_EQUAL(frame, result.frames[0], sizeof(frame));
+}
+
+TEST(HDLC, resync_counts_discarded_bytes)
+{
+    uint8_t buffer[512];
+    HdlcRxResult result{};
+    hdlc_ll_handle_t handle = nullptr;
+    hdlc_ll_init_t init{};
+    init.buf = buffer;
+    init.buf_size = sizeof(buffer);
+    init.crc_type = HDLC_CRC_16;
+    init.on_frame_read = hdlc_on_test_frame_read;
+    init.user_data = &result;
+    CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_init(&handle, &init));
+    const uint8_t frame[] = {0x01, 0x02, 0x03};
+    uint8_t stream[64] = {0x11, 0x22, 0x33, 0x44, 0xFF};
+    int stream_len = 5;
+    stream_len += hdlc_encode_frame(HDLC_CRC_16, frame, sizeof(frame), stream + stream_len, 32, 32);
+    int error = TINY_SUCCESS;
+    // Garbage is skipped at once
+    CHECK_EQUAL(5, hdlc_ll_run_rx(handle, stream, 5, &error));
+    CHECK_EQUAL(5, handle->stats.rx_discarded_bytes);
+    int pos = 5;
+    while ( pos < stream_len )
+    {
+        pos += hdlc_ll_run_rx(handle, stream + pos, stream_len - pos, &error);
+        CHECK_EQUAL(TINY_SUCCESS, error);
+    }
+    CHECK_EQUAL(1, result.count);
+    CHECK_EQUAL(5, handle->stats.rx_discarded_bytes);
+    hdlc_ll_close(handle);
+}
+
+static void hdlc_on_keep_frame_pointer(void *user_data, uint8_t *data, int len)
+{
+    std::vector<uint8_t *> *frames = static_cast<std::vector<uint8_t *> *>(user_data);
+    frames->push_back(data);
+}
+
+TEST(HDLC, rx_packed_keeps_more_frames)
+{
+    for ( bool packed : {false, true} )
+    {
+        // RX buffer holds 2 frames of mtu size
+        std::vector<uint8_t> buffer(hdlc_ll_get_buf_size_ex(16, HDLC_CRC_16, 2));
+        std::vector<uint8_t *> frames;
+        hdlc_ll_handle_t handle = nullptr;
+        hdlc_ll_init_t init{};
+        init.buf = buffer.data();
+        init.buf_size = (int)buffer.size();
+        init.crc_type = HDLC_CRC_16;
+        init.mtu = 16;
+        init.rx_packed = packed;
+        init.on_frame_read = hdlc_on_keep_frame_pointer;
+        init.user_data = &frames;
+        CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_init(&handle, &init));
+        uint8_t stream[128];
+        int stream_len = 0;
+        for ( uint8_t i = 1; i <= 4; i++ )
+        {
+            const uint8_t frame[3] = {i, i, i};
+            CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_put_frame(handle, frame, sizeof(frame)));
+            stream_len += hdlc_ll_run_tx(handle, stream + stream_len, sizeof(stream) - stream_len);
+        }
+        int pos = 0;
+        while ( pos < stream_len )
+        {
+            int error = TINY_SUCCESS;
+            pos += hdlc_ll_run_rx(handle, stream + pos, stream_len - pos, &error);
+        }
+        CHECK_EQUAL(4, (int)frames.size());
+        int intact = 0;
+        for ( uint8_t i = 1; i <= 4; i++ )
+        {
+            const uint8_t frame[3] = {i, i, i};
+            intact += memcmp(frames[i - 1], frame, sizeof(frame)) == 0;
+        }
+        // Packed frames of 5 bytes (with crc) take much less space than 18-byte slots
+        CHECK_EQUAL(packed ? 4 : 2, intact);
+        hdlc_ll_close(handle);
+    }
+}
+
+struct hdlc_hold_context
+{
+    hdlc_ll_handle_t handle;
+    std::vector<uint8_t *> frames;
+    std::vector<int> results;
+};
+
+static void hdlc_on_hold_frame(void *user_data, uint8_t *data, int len)
+{
+    hdlc_hold_context *ctx = static_cast<hdlc_hold_context *>(user_data);
+    ctx->frames.push_back(data);
+    ctx->results.push_back(hdlc_ll_rx_hold(ctx->handle, data));
+}
+
+TEST(HDLC, rx_hold_keeps_frames_until_release)
+{
+    // RX buffer holds 3 frames of mtu size, only 2 can be held
+    std::vector<uint8_t> buffer(hdlc_ll_get_buf_size_ex(16, HDLC_CRC_16, 3));
+    hdlc_hold_context ctx{};
+    hdlc_ll_init_t init{};
+    init.buf = buffer.data();
+    init.buf_size = (int)buffer.size();
+    init.crc_type = HDLC_CRC_16;
+    init.mtu = 16;
+    init.on_frame_read = hdlc_on_hold_frame;
+    init.user_data = &ctx;
+    CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_init(&ctx.handle, &init));
+    uint8_t stream[128];
+    int stream_len = 0;
+    for ( uint8_t i = 1; i <= 5; i++ )
+    {
+        const uint8_t frame[3] = {i, i, i};
+        CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_put_frame(ctx.handle, frame, sizeof(frame)));
+        stream_len += hdlc_ll_run_tx(ctx.handle, stream + stream_len, sizeof(stream) - stream_len);
+    }
+    int pos = 0;
+    while ( pos < stream_len )
+    {
+        pos += hdlc_ll_run_rx(ctx.handle, stream + pos, stream_len - pos, nullptr);
+    }
+    CHECK_EQUAL(5, (int)ctx.frames.size());
+    CHECK_EQUAL(TINY_SUCCESS, ctx.results[0]);
+    CHECK_EQUAL(TINY_SUCCESS, ctx.results[1]);
+    CHECK_EQUAL(TINY_ERR_BUSY, ctx.results[2]);
+    // Frames 3-5 are received to the only free slot, held frames are intact
+    CHECK(ctx.frames[2] == ctx.frames[4]);
+    CHECK_EQUAL(0, memcmp(ctx.frames[0], "\x01\x01\x01", 3));
+    CHECK_EQUAL(0, memcmp(ctx.frames[1], "\x02\x02\x02", 3));
+    CHECK_FALSE(hdlc_ll_rx_can_hold(ctx.handle));
+    CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_rx_release(ctx.handle, ctx.frames[0]));
+    CHECK_EQUAL(TINY_ERR_INVALID_DATA, hdlc_ll_rx_release(ctx.handle, ctx.frames[0]));
+    CHECK(hdlc_ll_rx_can_hold(ctx.handle));
+    hdlc_ll_close(ctx.handle);
+}
+
+TEST(HDLC, stats_counters)
+{
+    uint8_t buffer[512];
+    HdlcRxResult result{};
+    hdlc_ll_handle_t handle = nullptr;
+    hdlc_ll_init_t init{};
+    init.buf = buffer;
+    init.buf_size = sizeof(buffer);
+    init.crc_type = HDLC_CRC_16;
+    init.mtu = 16;
+    init.on_frame_read = hdlc_on_test_frame_read;
+    init.user_data = &result;
+    CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_init(&handle, &init));
+    const uint8_t frame[] = {0x7E, 0x01, 0x7D, 0x02};
+    uint8_t encoded[32];
+    CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_put_frame(handle, frame, sizeof(frame)));
+    int encoded_len = hdlc_ll_run_tx(handle, encoded, sizeof(encoded));
+    hdlc_ll_stats_t stats{};
+    CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_get_stats(handle, &stats));
+    CHECK_EQUAL(1, stats.tx_frames);
+    CHECK_EQUAL(sizeof(frame), stats.tx_bytes);
+    // Every escape char in the stream is inserted by byte stuffing, since 0x7D is escaped itself
+    CHECK_EQUAL(std::count(encoded, encoded + encoded_len, 0x7D), stats.tx_escapes);
+
+    uint8_t stream[128];
+    int stream_len = 0;
+    // valid frame
+    memcpy(stream + stream_len, encoded, encoded_len);
+    stream_len += encoded_len;
+    // corrupted frame
+    memcpy(stream + stream_len, encoded, encoded_len);
+    *std::find(stream + stream_len, stream + stream_len + encoded_len, 0x01) = 0x03;
+    stream_len += encoded_len;
+    // fill bytes do not mean the loss of alignment
+    stream[stream_len++] = 0xFF;
+    stream[stream_len++] = 0xFF;
+    // garbage before valid frame
+    stream[stream_len++] = 0x55;
+    stream[stream_len++] = 0x66;
+    memcpy(stream + stream_len, encoded, encoded_len);
+    stream_len += encoded_len;
+    // frame exceeding mtu
+    stream[stream_len++] = 0x7E;
+    memset(stream + stream_len, 0x11, 40);
+    stream_len += 40;
+    stream[stream_len++] = 0x7E;
+    int pos = 0;
+    while ( pos < stream_len )
+    {
+        int error = TINY_SUCCESS;
+        pos += hdlc_ll_run_rx(handle, stream + pos, stream_len - pos, &error);
+    }
+    CHECK_EQUAL(2, result.count);
+    CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_get_stats(handle, &stats));
+    CHECK_EQUAL(2, stats.rx_frames);
+    CHECK_EQUAL(2 * sizeof(frame), stats.rx_bytes);
+    CHECK_EQUAL(2, stats.rx_crc_errors);
+    CHECK_EQUAL(1, stats.rx_oversize_frames);
+    CHECK_EQUAL(1, stats.rx_resyncs);
+    CHECK_EQUAL(4, stats.rx_discarded_bytes);
+
+    hdlc_ll_reset_stats(handle);
+    CHECK_EQUAL(TINY_SUCCESS, hdlc_ll_get_stats(handle, &stats));
+    CHECK_EQUAL(0, stats.rx_frames);
+    CHECK_EQUAL(0, stats.tx_escapes);
+    CHECK_EQUAL(TINY_ERR_INVALID_DATA, hdlc_ll_get_stats(handle, nullptr));
+    hdlc_ll_close(handle);
+}
@@ -66,6 +66,17 @@ void TinyHelperFd::setPeersCount(uint8_t count)
     m_peersCount = count;
 }
 
+void TinyHelperFd::setFraming(hdlc_framing_t framing)
+{
+    m_framing = framing;
+}
+
+void TinyHelperFd::setSmallFrames(uint8_t frames, int mtu)
+{
+    m_smallFrames = frames;
+    m_smallMtu = mtu;
+}
+
 int TinyHelperFd::init()
 {
     tiny_fd_init_t init{};
@@ -84,6 +95,9 @@ int TinyHelperFd::init()
     init.peers_count = m_peersCount;
     init.addr = m_addr;
     init.crc_type = HDLC_CRC_16;
+    init.framing = m_framing;
+    init.small_frames = m_smallFrames;
+    init.small_mtu = m_smallMtu;
 
     return tiny_fd_init(&m_handle, &init);
 }
@@ -53,6 +53,8 @@ public:
     void setAddress(uint8_t address);
     void setPeersCount(uint8_t count);
     void setTimeout(int timeout);
+    void setFraming(hdlc_framing_t framing);
+    void setSmallFrames(uint8_t frames, int mtu);
     int init();
 
     int registerPeer(uint8_t address);
@@ -92,6 +94,9 @@ private:
     uint8_t m_mode = TINY_FD_MODE_ABM;
     uint8_t m_peersCount = 1;
     uint8_t m_addr = TINY_FD_PRIMARY_ADDR;
+    hdlc_framing_t m_framing = HDLC_FRAMING_HDLC;
+    uint8_t m_smallFrames = 0;
+    int m_smallMtu = 0;
     int m_rxBufferSize;
     int m_window;
     int m_timeout;
@@ -28,7 +28,9 @@
 */
 
 #include <CppUTest/TestHarness.h>
+#include <string.h>
 #include "proto/crc/tiny_crc.h"
+#include "proto/crc/tiny_crc_int.h"
 
 TEST_GROUP(TinyCrcTests)
 {
@@ -64,4 +66,126 @@ TEST(TinyCrcTests, Crc32)
     // Just check it doesn't match the initial CRC
     CHECK_TRUE(crc != PPPINITFCS32);
 #endif
-}
\ No newline at end of file
+}
+TEST(TinyCrcTests, StreamingUpdate)
+{
+    uint8_t buf[37];
+    for ( unsigned i = 0; i < sizeof(buf); i++ )
+    {
+        buf[i] = (uint8_t)(i * 37 + 11);
+    }
+#ifdef CONFIG_ENABLE_FCS16
+    uint16_t crc16 = tiny_crc16_update(PPPINITFCS16, buf, 5);
+    crc16 = tiny_crc16_update(crc16, buf + 5, sizeof(buf) - 5);
+    CHECK_EQUAL(tiny_crc16(PPPINITFCS16, buf, sizeof(buf)), (uint16_t)(crc16 ^ 0xFFFF));
+#endif
+#ifdef CONFIG_ENABLE_FCS32
+    uint32_t crc32 = tiny_crc32_update(PPPINITFCS32, buf, 13);
+    crc32 = tiny_crc32_update(crc32, buf + 13, sizeof(buf) - 13);
+    CHECK_EQUAL(tiny_crc32(PPPINITFCS32, buf, sizeof(buf)), crc32 ^ 0xFFFFFFFF);
+#endif
+#ifdef CONFIG_ENABLE_CHECKSUM
+    uint16_t sum = tiny_chksum_update(INITCHECKSUM, buf, 20);
+    sum = tiny_chksum_update(sum, buf + 20, sizeof(buf) - 20);
+    CHECK_EQUAL(tiny_chksum(INITCHECKSUM, buf, sizeof(buf)), (uint16_t)(0xFFFF - sum));
+#endif
+}
+
+static uint32_t crc_bitwise(uint32_t crc, uint32_t poly, const uint8_t *buf, int size)
+{
+    while ( size-- )
+    {
+        crc ^= *buf++;
+        for ( int i = 0; i < 8; i++ )
+        {
+            crc = (crc & 1) ? (crc >> 1) ^ poly : (crc >> 1);
+        }
+    }
+    return crc;
+}
+
+TEST(TinyCrcTests, SlicedMatchesBitwise)
+{
+    uint8_t buf[300];
+    for ( unsigned i = 0; i < sizeof(buf); i++ )
+    {
+        buf[i] = (uint8_t)(i * 151 + (i >> 3) + 7);
+    }
+    // Cover every tail length and misaligned start for the sliced kernels
+    for ( int offset = 0; offset < 8; offset++ )
+    {
+        for ( int len = 0; len < (int)sizeof(buf) - offset; len += (len < 40 ? 1 : 37) )
+        {
+#ifdef CONFIG_ENABLE_FCS16
+            CHECK_EQUAL((uint16_t)crc_bitwise(PPPINITFCS16, 0x8408, buf + offset, len),
+                        tiny_crc16_update(PPPINITFCS16, buf + offset, len));
+#endif
+#ifdef CONFIG_ENABLE_FCS32
+            CHECK_EQUAL(crc_bitwise(PPPINITFCS32, 0xEDB88320, buf + offset, len),
+                        tiny_crc32_update(PPPINITFCS32, buf + offset, len));
+#endif
+        }
+    }
+}
+
+#ifdef CONFIG_ENABLE_FCS32
+TEST(TinyCrcTests, HardwareCrc32MatchesTable)
+{
+    static uint8_t buf[4096 + 16];
+    for ( unsigned i = 0; i < sizeof(buf); i++ )
+    {
+        buf[i] = (uint8_t)((i * 2654435761u) >> 13);
+    }
+    uint32_t bitwise = crc_bitwise(PPPINITFCS32, 0xEDB88320, buf, 4096);
+    CHECK_EQUAL(bitwise, tiny_crc32_sw_update(PPPINITFCS32, buf, 4096));
+    CHECK_EQUAL(bitwise, tiny_crc32_update(PPPINITFCS32, buf, 4096));
+    tiny_crc32_update_fn hw = tiny_crc32_hw_detect();
+    if ( hw == NULL )
+    {
+        return;
+    }
+    for ( int offset = 0; offset < 16; offset += 3 )
+    {
+        for ( int len = 0; len <= 4096; len += (len < 200 ? 1 : 251) )
+        {
+            CHECK_EQUAL(tiny_crc32_sw_update(PPPINITFCS32, buf + offset, len), hw(PPPINITFCS32, buf + offset, len));
+            CHECK_EQUAL(tiny_crc32_sw_update(0x12345678, buf + offset, len), hw(0x12345678, buf + offset, len));
+        }
+    }
+}
+#endif
+
+#ifdef CONFIG_ENABLE_CRC32C
+TEST(TinyCrcTests, Crc32c)
+{
+    const uint8_t check[] = "123456789";
+    CHECK_EQUAL(0xE3069283, tiny_crc32c(INITCRC32C, check, 9));
+    uint32_t crc = tiny_crc32c(INITCRC32C, check, 9);
+    uint8_t frame[13];
+    memcpy(frame, check, 9);
+    for ( int i = 0; i < 4; i++ )
+    {
+        frame[9 + i] = (uint8_t)(crc >> (8 * i));
+    }
+    CHECK_EQUAL(GOODCRC32C, tiny_crc32c_update(INITCRC32C, frame, sizeof(frame)));
+
+    static uint8_t buf[4096 + 16];
+    for ( unsigned i = 0; i < sizeof(buf); i++ )
+    {
+        buf[i] = (uint8_t)((i * 2654435761u) >> 11);
+    }
+    CHECK_EQUAL(crc_bitwise(INITCRC32C, 0x82F63B78, buf, 4096), tiny_crc32c_update(INITCRC32C, buf, 4096));
+    tiny_crc32_update_fn hw = tiny_crc32c_hw_detect();
+    if ( hw == NULL )
+    {
+        return;
+    }
+    for ( int offset = 0; offset < 16; offset += 3 )
+    {
+        for ( int len = 0; len <= 4096; len += (len < 200 ? 1 : 251) )
+        {
+            CHECK_EQUAL(tiny_crc32c_sw_update(INITCRC32C, buf + offset, len), hw(INITCRC32C, buf + offset, len));
+        }
+    }
+}
+#endif
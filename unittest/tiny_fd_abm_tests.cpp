@@ -33,6 +33,7 @@
 #include <string.h>
 #include <thread>
 #include <array>
+#include <vector>
 
 #include "proto/fd/tiny_fd.h"
 
@@ -41,33 +42,23 @@ TEST_GROUP(TINY_FD_ABM)
     void setup()
     {
         connected = false;
-        tiny_fd_init_t init{};
-        init.pdata = this;
-        init.on_connect_event_cb = __onConnect;
-        init.on_read_cb = onRead;
-        init.on_send_cb = onSend;
-        init.log_frame_cb = logFrame;
-        init.buffer = inBuffer.data();
-        init.buffer_size = inBuffer.size();
-        init.window_frames = 7;
-        init.send_timeout = 1000;
-        init.retry_timeout = 100;
-        init.retries = 2;
-        init.mode = TINY_FD_MODE_ABM;
-        init.peers_count = 1; // For ABM mode, only one peer is needed
-        init.crc_type = HDLC_CRC_OFF;
+        tiny_fd_init_t init = defaultInit();
         auto result = tiny_fd_init(&handle, &init);
         CHECK_EQUAL(TINY_SUCCESS, result);
     }
 
     void teardown()
     {
-        tiny_fd_close(handle);
+        if ( handle )
+        {
+            tiny_fd_close(handle);
+        }
         logFrameFunc = nullptr;
+        readFunc = nullptr;
     }
 
     void onConnect(uint8_t, bool status) { connected = status; }
-    void onRead(uint8_t, uint8_t *, int) { }
+    void onRead(uint8_t, uint8_t *buf, int len) { if (readFunc) readFunc(buf, len); }
     void onSend(uint8_t, const uint8_t *, int) { }
 
     static void __onConnect(void *udata, uint8_t address, bool connected)
@@ -110,6 +101,8 @@ TEST_GROUP(TINY_FD_ABM)
     std::function<void(tiny_fd_handle_t, tiny_fd_frame_direction_t,
                        tiny_fd_frame_type_t, tiny_fd_frame_subtype_t, uint8_t, uint8_t,
                        const uint8_t *, int)> logFrameFunc = nullptr;
+    std::function<void(uint8_t *, int)> readFunc = nullptr;
+    std::vector<uint8_t> extBuffer;
 
     void establishConnection()
     {
@@ -121,9 +114,9 @@ TEST_GROUP(TINY_FD_ABM)
         CHECK_EQUAL(4, len);
     }
     
-    void reinitializeWithMtu(int mtu)
+    // Configuration used by setup(), tests change only the fields they need
+    tiny_fd_init_t defaultInit()
     {
-        tiny_fd_close(handle); // Close the previous handle
         tiny_fd_init_t init{};
         init.pdata = this;
         init.on_connect_event_cb = __onConnect;
@@ -139,8 +132,42 @@ TEST_GROUP(TINY_FD_ABM)
         init.mode = TINY_FD_MODE_ABM;
         init.peers_count = 1; // For ABM mode, only one peer is needed
         init.crc_type = HDLC_CRC_OFF;
+        return init;
+    }
+
+    // Restarts the protocol with new configuration, sizeByInit replaces the buffer with one of
+    // tiny_fd_buffer_size_by_init() bytes
+    int reinitialize(tiny_fd_init_t &init, bool sizeByInit = false)
+    {
+        if ( handle )
+        {
+            tiny_fd_close(handle);
+            handle = nullptr;
+        }
+        if ( sizeByInit )
+        {
+            extBuffer.resize(tiny_fd_buffer_size_by_init(&init));
+            init.buffer = extBuffer.data();
+            init.buffer_size = extBuffer.size();
+        }
+        return tiny_fd_init(&handle, &init);
+    }
+
+    void reinitializeInExtendedMode(uint8_t window, int mtu)
+    {
+        tiny_fd_init_t init = defaultInit();
+        init.window_frames = window;
+        init.mtu = mtu;
+        init.extended_mode = true;
+        // Wide window doesn't fit the default buffer
+        CHECK_EQUAL(TINY_SUCCESS, reinitialize(init, true));
+    }
+
+    void reinitializeWithMtu(int mtu)
+    {
+        tiny_fd_init_t init = defaultInit();
         init.mtu = mtu; // Set MTU
-        auto result = tiny_fd_init(&handle, &init);
+        auto result = reinitialize(init);
         CHECK_EQUAL(TINY_SUCCESS, result);
     }
 
@@ -595,7 +622,11 @@ TEST(TINY_FD_ABM, ABM_UIFrameSend)
     // UI frames can be sent even when disconnected (connectionless)
     int result = tiny_fd_send_ui_packet(handle, (const void *)"\xDE\xAD", 2);
     CHECK_EQUAL(TINY_SUCCESS, result);
+    // Service frames go ahead of UI frames, so SABM of connection attempt is sent first
     int len = tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100);
+    CHECK_EQUAL(4, len);
+    CHECK_EQUAL(0x3F, outBuffer[2]); // SABM with P bit
+    len = tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100);
     CHECK_EQUAL(6, len); // flag + addr + control + 2 data bytes + flag
     CHECK_EQUAL(0x7E, outBuffer[0]); // Flag
     CHECK_EQUAL(0x01, outBuffer[1]); // Address field
@@ -605,6 +636,101 @@ TEST(TINY_FD_ABM, ABM_UIFrameSend)
     CHECK_EQUAL(0x7E, outBuffer[5]); // Flag
 }
 
+TEST(TINY_FD_ABM, ABM_UIQueueDoesNotBlockServiceFrames)
+{
+    tiny_fd_init_t init = defaultInit();
+    init.ui_frames = 2;
+    init.ui_mtu = 8;
+    CHECK_EQUAL(TINY_SUCCESS, reinitialize(init));
+    establishConnection();
+
+    CHECK_EQUAL(TINY_ERR_DATA_TOO_LARGE, tiny_fd_send_ui_packet(handle, "123456789", 9));
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_ui_packet(handle, "12345678", 8));
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_ui_packet(handle, "ABCDEFGH", 8));
+    CHECK_EQUAL(TINY_ERR_FAILED, tiny_fd_send_ui_packet(handle, "X", 1));
+    // UI queue is full, but RR still can be queued, and it is sent first
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x03\x00\x11\x7E", 5));
+    int len = tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100);
+    CHECK_EQUAL(4, len);
+    CHECK_EQUAL(0x21, outBuffer[2]); // RR with N(R) = 1
+    len = tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100);
+    CHECK_EQUAL(12, len);
+    CHECK_EQUAL(0x13, outBuffer[2]); // UI
+    CHECK_EQUAL(0, memcmp(&outBuffer[3], "12345678", 8));
+    // Sent slot is free again
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_ui_packet(handle, "X", 1));
+}
+
+TEST(TINY_FD_ABM, ABM_ZeroCopyReserveCommit)
+{
+    establishConnection();
+    uint8_t *buf = tiny_fd_tx_reserve(handle, TINY_FD_PRIMARY_ADDR, 4, 0);
+    CHECK(buf != nullptr);
+    // Other frames wait until reserved slot is committed
+    CHECK_EQUAL(TINY_ERR_TIMEOUT, tiny_fd_send_packet(handle, "X", 1, 0));
+    buf[0] = 'A';
+    buf[1] = 'B';
+    CHECK_EQUAL(TINY_ERR_DATA_TOO_LARGE, tiny_fd_tx_commit(handle, buf, 5));
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_tx_commit(handle, buf, 2));
+    CHECK_EQUAL(TINY_ERR_INVALID_DATA, tiny_fd_tx_commit(handle, buf, 2));
+    int len = tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100);
+    CHECK_EQUAL(6, len);
+    CHECK_EQUAL(0x00, outBuffer[2]); // I(0,0)
+    CHECK_EQUAL(0, memcmp(&outBuffer[3], "AB", 2));
+
+    // Aborted slot is returned to the queue, and the peer accepts frames again
+    buf = tiny_fd_tx_reserve(handle, TINY_FD_PRIMARY_ADDR, 4, 0);
+    CHECK(buf != nullptr);
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_tx_abort(handle, buf));
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "X", 1, 0));
+    len = tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100);
+    CHECK_EQUAL(5, len);
+    CHECK_EQUAL(0x02, outBuffer[2]); // I(1,0)
+    CHECK_EQUAL('X', outBuffer[3]);
+}
+
+TEST(TINY_FD_ABM, ABM_RxHoldWithholdsFramesWhenAllSlotsOnLoan)
+{
+    tiny_fd_init_t init = defaultInit();
+    init.window_frames = 3;
+    init.mtu = 16;
+    init.rx_hold_frames = 2;
+    CHECK_EQUAL(TINY_SUCCESS, reinitialize(init, true));
+    establishConnection();
+    std::vector<uint8_t *> held;
+    readFunc = [&](uint8_t *buf, int len) {
+        CHECK_EQUAL(TINY_SUCCESS, tiny_fd_rx_hold(handle, buf));
+        held.push_back(buf);
+    };
+    // Hold frames until the protocol has no more RX slots to loan, one slot is always left for receiving
+    uint8_t ns = 0;
+    for ( ; ns < 2; ns++ )
+    {
+        const uint8_t frame[] = {0x7E, 0x03, (uint8_t)(ns << 1), (uint8_t)('A' + ns), 0x7E};
+        CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, frame, sizeof(frame)));
+    }
+    CHECK_EQUAL(2, (int)held.size());
+    // All slots are on loan: next frame is not delivered
+    const uint8_t frame[] = {0x7E, 0x03, (uint8_t)(ns << 1), 'X', 0x7E};
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, frame, sizeof(frame)));
+    CHECK_EQUAL(2, (int)held.size());
+    CHECK_EQUAL(0, memcmp(held[0], "A", 1));
+    CHECK_EQUAL(0, memcmp(held[1], "B", 1));
+    // Release asks remote side to repeat the frame
+    while ( tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0) > 0 );
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_rx_release(handle, held[0]));
+    CHECK_EQUAL(TINY_ERR_INVALID_DATA, tiny_fd_rx_release(handle, held[0]));
+    int len = tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100);
+    CHECK_EQUAL(4, len);
+    CHECK_EQUAL(0x01, outBuffer[1]); // Response, as RR and RNR
+    CHECK_EQUAL(0x09 | (ns << 5), outBuffer[2]); // REJ with N(R) of dropped frame
+    readFunc = nullptr;
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, frame, sizeof(frame)));
+    len = tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100);
+    CHECK_EQUAL(4, len);
+    CHECK_EQUAL(0x01 | ((ns + 1) << 5), outBuffer[2]); // RR confirms retransmitted frame
+}
+
 // Static callback state for UI receive tests
 static bool s_ui_received = false;
 static uint8_t s_ui_data[16] = {};
@@ -620,6 +746,116 @@ static void ui_read_callback(void *, uint8_t, uint8_t *buf, int len)
     }
 }
 
+TEST(TINY_FD_ABM, ABM_TxQueueSendsFramesBackToBack)
+{
+    tiny_fd_init_t init = defaultInit();
+    init.mtu = 8;
+    init.tx_queue_size = 2;
+    init.shared_flag = true;
+    CHECK_EQUAL(TINY_SUCCESS, reinitialize(init, true));
+    establishConnection();
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "A", 1, 0));
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "B", 1, 0));
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "C", 1, 0));
+    // Single call returns all three I-frames, and neighbour frames share the flag
+    const uint8_t expected[] = {0x7E, 0x01, 0x00, 'A', 0x7E, 0x01, 0x02, 'B', 0x7E, 0x01, 0x04, 'C', 0x7E};
+    int len = tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0);
+    CHECK_EQUAL(sizeof(expected), len);
+    MEMCMP_EQUAL(expected, outBuffer.data(), sizeof(expected));
+    CHECK_EQUAL(0, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+}
+
+// Reads all pending TX data and splits it into frames (address, control, payload) by flag bytes
+static std::vector<std::vector<uint8_t>> drainFrames(tiny_fd_handle_t handle, std::vector<uint8_t> wire = {})
+{
+    uint8_t buf[64];
+    int len;
+    while ( (len = tiny_fd_get_tx_data(handle, buf, sizeof(buf), 0)) > 0 )
+    {
+        wire.insert(wire.end(), buf, buf + len);
+    }
+    std::vector<std::vector<uint8_t>> frames;
+    std::vector<uint8_t> frame;
+    for ( uint8_t byte : wire )
+    {
+        if ( byte != 0x7E )
+        {
+            frame.push_back(byte);
+        }
+        else if ( !frame.empty() )
+        {
+            frames.push_back(frame);
+            frame.clear();
+        }
+    }
+    return frames;
+}
+
+TEST(TINY_FD_ABM, ABM_TxQueueRewoundByRej)
+{
+    tiny_fd_init_t init = defaultInit();
+    init.mtu = 8;
+    init.tx_queue_size = 2;
+    CHECK_EQUAL(TINY_SUCCESS, reinitialize(init, true));
+    establishConnection();
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "A", 1, 0));
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "B", 1, 0));
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "C", 1, 0));
+    // I(0) is being sent, I(1) and I(2) wait in hdlc TX queue
+    CHECK_EQUAL(2, tiny_fd_get_tx_data(handle, outBuffer.data(), 2, 0));
+    std::vector<uint8_t> wire(outBuffer.begin(), outBuffer.begin() + 2);
+    // Peer rejects everything starting from I(0)
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x01\x09\x7E", 4));
+    // I(0) is completed, and then all frames are sent once again in order, without queued duplicates
+    auto frames = drainFrames(handle, wire);
+    const uint8_t expected[][3] = {{0x01, 0x00, 'A'}, {0x01, 0x00, 'A'}, {0x01, 0x02, 'B'}, {0x01, 0x04, 'C'}};
+    CHECK_EQUAL(4, frames.size());
+    for ( size_t i = 0; i < frames.size() && i < 4; i++ )
+    {
+        CHECK_EQUAL(3, frames[i].size());
+        MEMCMP_EQUAL(expected[i], frames[i].data(), 3);
+    }
+}
+
+TEST(TINY_FD_ABM, ABM_TxQueuePurgedOnDisconnect)
+{
+    tiny_fd_init_t init = defaultInit();
+    init.mtu = 8;
+    init.tx_queue_size = 2;
+    CHECK_EQUAL(TINY_SUCCESS, reinitialize(init, true));
+    establishConnection();
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "A", 1, 0));
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "B", 1, 0));
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "C", 1, 0));
+    // I(0) is being sent, I(1) and I(2) wait in hdlc TX queue
+    CHECK_EQUAL(2, tiny_fd_get_tx_data(handle, outBuffer.data(), 2, 0));
+    std::vector<uint8_t> wire(outBuffer.begin(), outBuffer.begin() + 2);
+    // Peer disconnects (DISC+P) and connects again (SABM) before I(0) is completed
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x03\x53\x7E", 4));
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x03\x2F\x7E", 4));
+    // Slot of I(0) is still read by hdlc level, so new frames must not reuse it
+    for ( const char *data : {"X", "Y", "Z", "U", "V", "W"} )
+    {
+        CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, data, 1, 0));
+    }
+    // I(0) is completed intact, frames of the old connection are dropped
+    auto frames = drainFrames(handle, wire);
+    const uint8_t expected[][3] = {{0x01, 0x00, 'A'}, {0x01, 0x73}, {0x01, 0x73}, {0x01, 0x00, 'X'}, {0x01, 0x02, 'Y'},
+                                   {0x01, 0x04, 'Z'}, {0x01, 0x06, 'U'}, {0x01, 0x08, 'V'}, {0x01, 0x0A, 'W'}};
+    CHECK_EQUAL(9, frames.size());
+    for ( size_t i = 0; i < frames.size() && i < 9; i++ )
+    {
+        CHECK_EQUAL(i == 1 || i == 2 ? 2 : 3, frames[i].size());
+        MEMCMP_EQUAL(expected[i], frames[i].data(), frames[i].size());
+    }
+    // Slot of I(0) is released after it is sent, so the whole window is available again
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x01\xC1\x7E", 4));
+    for ( int i = 0; i < 7; i++ )
+    {
+        CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "D", 1, 0));
+    }
+}
+
 TEST(TINY_FD_ABM, ABM_UIFrameReceiveConnected)
 {
     // UI frames can be received when connected
@@ -803,4 +1039,495 @@ TEST(TINY_FD_ABM, ABM_REJRetransmitsAllFromNR)
     int len2 = tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100);
     CHECK(len2 > 0);
     CHECK_EQUAL(0x01, (outBuffer[2] >> 1) & 0x07); // N(S) = 1 (second retransmit)
-}
\ No newline at end of file
+}
+
+TEST(TINY_FD_ABM, ABM_ExtendedModeHandshake)
+{
+    reinitializeInExtendedMode(16, 8);
+    CHECK_EQUAL(8, tiny_fd_get_mtu(handle));
+    // SABM requests modulo 8 link, which is refused by DM
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x03\x2F\x7E", 4));
+    int len = tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100);
+    CHECK_EQUAL(4, len);
+    CHECK_EQUAL(0x1F, outBuffer[2]); // DM with F bit
+    CHECK(!connected);
+    // SABME with P bit
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x03\x7F\x7E", 4));
+    len = tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100);
+    CHECK_EQUAL(4, len);
+    CHECK_EQUAL(0x73, outBuffer[2]); // UA with F bit
+    CHECK(connected);
+    // I-frame N(S)=0, N(R)=0 with 2-byte control field
+    std::vector<uint8_t> received;
+    readFunc = [&](uint8_t *buf, int len) { received.assign(buf, buf + len); };
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x03\x00\x00\x41\x7E", 6));
+    CHECK_EQUAL(1, (int)received.size());
+    CHECK_EQUAL('A', received[0]);
+    len = tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100);
+    CHECK_EQUAL(5, len);
+    CHECK_EQUAL(0x01, outBuffer[2]); // RR
+    CHECK_EQUAL(0x02, outBuffer[3]); // N(R)=1, no P/F bit
+}
+
+TEST(TINY_FD_ABM, ABM_ExtendedModeWindowAbove7)
+{
+    tiny_fd_init_t init{};
+    init.on_read_cb = onRead;
+    init.buffer = inBuffer.data();
+    init.buffer_size = inBuffer.size();
+    init.window_frames = 8;
+    init.mtu = 8;
+    init.send_timeout = 1000;
+    init.crc_type = HDLC_CRC_OFF;
+    tiny_fd_handle_t other = nullptr;
+    CHECK_EQUAL(TINY_ERR_INVALID_DATA, tiny_fd_init(&other, &init)); // Exceeds modulo 8 sequence space
+
+    reinitializeInExtendedMode(16, 8);
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x03\x7F\x7E", 4));
+    CHECK(tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100) > 0);
+    CHECK(connected);
+    std::vector<uint8_t> sent;
+    logFrameFunc = [&](tiny_fd_handle_t, tiny_fd_frame_direction_t direction, tiny_fd_frame_type_t frame_type,
+                       tiny_fd_frame_subtype_t, uint8_t ns, uint8_t nr, const uint8_t *, int) {
+        if ( direction == TINY_FD_FRAME_DIRECTION_OUT && frame_type == TINY_FD_FRAME_TYPE_I )
+        {
+            sent.push_back(ns);
+        }
+    };
+    // All 12 frames go to the line without waiting for acknowledgement
+    for ( int i = 0; i < 12; i++ )
+    {
+        CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "x", 1, 0));
+    }
+    while ( tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0) > 0 );
+    CHECK_EQUAL(12, (int)sent.size());
+    for ( int i = 0; i < 12; i++ )
+    {
+        CHECK_EQUAL(i, sent[i]);
+    }
+    // RR N(R)=12 confirms all of them, so the whole window is available again
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x01\x01\x18\x7E", 5));
+    for ( int i = 0; i < 15; i++ )
+    {
+        CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "y", 1, 0));
+    }
+    CHECK(tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0) > 0);
+    CHECK_EQUAL(12, sent[12]);
+}
+
+TEST(TINY_FD_ABM, ABM_SelectiveRepeatBuffersOutOfOrderFrames)
+{
+    tiny_fd_init_t init = defaultInit();
+    // Out of order frames are kept in the rest of the buffer as HDLC RX slots
+    init.window_frames = 5;
+    init.mtu = 8;
+    init.selective_repeat = true;
+    CHECK_EQUAL(TINY_ERR_INVALID_DATA, reinitialize(init)); // Exceeds half of sequence space
+    init.window_frames = 4;
+    CHECK_EQUAL(TINY_SUCCESS, reinitialize(init));
+    establishConnection();
+    std::string received;
+    readFunc = [&](uint8_t *buf, int len) { received.append((char *)buf, len); };
+    std::vector<std::pair<uint8_t, uint8_t>> sent;
+    logFrameFunc = [&](tiny_fd_handle_t, tiny_fd_frame_direction_t direction, tiny_fd_frame_type_t frame_type,
+                       tiny_fd_frame_subtype_t frame_subtype, uint8_t, uint8_t nr, const uint8_t *, int) {
+        if ( direction == TINY_FD_FRAME_DIRECTION_OUT && frame_type == TINY_FD_FRAME_TYPE_S )
+        {
+            sent.push_back({frame_subtype, nr});
+        }
+    };
+    // Frame N(S)=1 is lost on the line
+    for ( uint8_t ns : {0, 2, 3} )
+    {
+        const uint8_t frame[] = {0x7E, 0x03, (uint8_t)(ns << 1), (uint8_t)('A' + ns), 0x7E};
+        CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, frame, sizeof(frame)));
+    }
+    while ( tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0) > 0 );
+    CHECK_EQUAL(std::string("A"), received);
+    CHECK_EQUAL(2, (int)sent.size());
+    CHECK_EQUAL(TINY_FD_FRAME_SUBTYPE_RR, sent[0].first);
+    CHECK_EQUAL(TINY_FD_FRAME_SUBTYPE_SREJ, sent[1].first); // Only missing frame is requested
+    CHECK_EQUAL(1, sent[1].second);
+    // Retransmitted frame fills the gap, and all buffered frames are delivered in order
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x03\x02" "B" "\x7E", 5));
+    while ( tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0) > 0 );
+    CHECK_EQUAL(std::string("ABCD"), received);
+    CHECK_EQUAL(3, (int)sent.size());
+    CHECK_EQUAL(TINY_FD_FRAME_SUBTYPE_RR, sent[2].first);
+    CHECK_EQUAL(4, sent[2].second);
+}
+
+TEST(TINY_FD_ABM, ABM_SelectiveRepeatBufferSizeByInit)
+{
+    tiny_fd_init_t init = defaultInit();
+    init.window_frames = 4;
+    init.mtu = 8;
+    init.selective_repeat = true;
+    // The smallest buffer, calculated for the configuration, must keep out of order frames
+    CHECK_EQUAL(TINY_SUCCESS, reinitialize(init, true));
+    establishConnection();
+    std::string received;
+    readFunc = [&](uint8_t *buf, int len) { received.append((char *)buf, len); };
+    std::vector<std::pair<uint8_t, uint8_t>> sent;
+    logFrameFunc = [&](tiny_fd_handle_t, tiny_fd_frame_direction_t direction, tiny_fd_frame_type_t frame_type,
+                       tiny_fd_frame_subtype_t frame_subtype, uint8_t, uint8_t nr, const uint8_t *, int) {
+        if ( direction == TINY_FD_FRAME_DIRECTION_OUT && frame_type == TINY_FD_FRAME_TYPE_S )
+        {
+            sent.push_back({frame_subtype, nr});
+        }
+    };
+    // Frame N(S)=0 is lost on the line
+    for ( uint8_t ns : {1, 2, 3} )
+    {
+        const uint8_t frame[] = {0x7E, 0x03, (uint8_t)(ns << 1), (uint8_t)('A' + ns), 0x7E};
+        CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, frame, sizeof(frame)));
+    }
+    while ( tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0) > 0 );
+    CHECK_EQUAL(std::string(""), received);
+    CHECK_EQUAL(1, (int)sent.size());
+    CHECK_EQUAL(TINY_FD_FRAME_SUBTYPE_SREJ, sent[0].first);
+    CHECK_EQUAL(0, sent[0].second);
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x03\x00" "A" "\x7E", 5));
+    while ( tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0) > 0 );
+    CHECK_EQUAL(std::string("ABCD"), received);
+    CHECK_EQUAL(2, (int)sent.size());
+    CHECK_EQUAL(TINY_FD_FRAME_SUBTYPE_RR, sent[1].first);
+    CHECK_EQUAL(4, sent[1].second);
+    // Slots for frames, held by the application, are reserved on top of that
+    const int size = tiny_fd_buffer_size_by_init(&init);
+    init.rx_hold_frames = 2;
+    CHECK(tiny_fd_buffer_size_by_init(&init) > size);
+}
+
+TEST(TINY_FD_ABM, ABM_SelectiveRepeatExtendedWindow64)
+{
+    tiny_fd_init_t init = defaultInit();
+    init.window_frames = 64;
+    init.mtu = 8;
+    init.extended_mode = true;
+    init.selective_repeat = true;
+    // Out of order frames, the missing frame and the new frame must fit 32 HDLC RX slots
+    CHECK_EQUAL(TINY_SUCCESS, reinitialize(init, true));
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x03\x7F\x7E", 4));
+    CHECK_EQUAL(4, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+    CHECK(connected);
+    std::vector<uint8_t> received;
+    readFunc = [&](uint8_t *buf, int len) { received.insert(received.end(), buf, buf + len); };
+    // Frame N(S)=0 is lost on the line, only 30 next frames can be buffered
+    for ( uint8_t ns = 1; ns <= 31; ns++ )
+    {
+        const uint8_t frame[] = {0x7E, 0x03, (uint8_t)(ns << 1), 0x00, ns, 0x7E};
+        CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, frame, sizeof(frame)));
+    }
+    while ( tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0) > 0 );
+    CHECK_EQUAL(0, (int)received.size());
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x03\x00\x00\x00\x7E", 6));
+    CHECK_EQUAL(31, (int)received.size());
+    // Dropped frame is accepted when it is sent again
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x03\x3E\x00\x1F\x7E", 6));
+    CHECK_EQUAL(32, (int)received.size());
+    for ( int i = 0; i < (int)received.size(); i++ )
+    {
+        CHECK_EQUAL(i, received[i]);
+    }
+    readFunc = nullptr;
+    // Frames, held by the user, don't fit on top of them
+    init.rx_hold_frames = 1;
+    CHECK_EQUAL(TINY_ERR_INVALID_DATA, reinitialize(init, true));
+}
+
+TEST(TINY_FD_ABM, ABM_RnrSentWhileAllRxSlotsOnLoan)
+{
+    tiny_fd_init_t init = defaultInit();
+    init.window_frames = 3;
+    init.mtu = 16;
+    init.rx_hold_frames = 2;
+    CHECK_EQUAL(TINY_SUCCESS, reinitialize(init, true));
+    establishConnection();
+    std::vector<uint8_t *> held;
+    readFunc = [&](uint8_t *buf, int len) {
+        CHECK_EQUAL(TINY_SUCCESS, tiny_fd_rx_hold(handle, buf));
+        held.push_back(buf);
+    };
+    std::vector<std::pair<uint8_t, uint8_t>> sent;
+    logFrameFunc = [&](tiny_fd_handle_t, tiny_fd_frame_direction_t direction, tiny_fd_frame_type_t frame_type,
+                       tiny_fd_frame_subtype_t frame_subtype, uint8_t, uint8_t nr, const uint8_t *, int) {
+        if ( direction == TINY_FD_FRAME_DIRECTION_OUT && frame_type == TINY_FD_FRAME_TYPE_S )
+        {
+            sent.push_back({frame_subtype, nr});
+        }
+    };
+    for ( uint8_t ns = 0; ns < 2; ns++ )
+    {
+        const uint8_t frame[] = {0x7E, 0x03, (uint8_t)(ns << 1), (uint8_t)('A' + ns), 0x7E};
+        CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, frame, sizeof(frame)));
+        while ( tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0) > 0 );
+    }
+    // The last holdable slot is taken: RNR confirms the frame and stops the peer
+    CHECK_EQUAL(2, (int)sent.size());
+    CHECK_EQUAL(TINY_FD_FRAME_SUBTYPE_RR, sent[0].first);
+    CHECK_EQUAL(TINY_FD_FRAME_SUBTYPE_RNR, sent[1].first);
+    CHECK_EQUAL(2, sent[1].second);
+    // Poll is answered by RNR with final bit while busy
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x03\x11\x7E", 4));
+    CHECK_EQUAL(4, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+    CHECK_EQUAL(0x55, outBuffer[2]); // RNR, N(R)=2, F
+    // Released slot clears busy condition
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_rx_release(handle, held[0]));
+    CHECK_EQUAL(4, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+    CHECK_EQUAL(0x41, outBuffer[2]); // RR, N(R)=2
+    readFunc = nullptr;
+}
+
+TEST(TINY_FD_ABM, ABM_RxHoldFramesLimitedBy32Slots)
+{
+    tiny_fd_init_t init = defaultInit();
+    init.window_frames = 4;
+    init.mtu = 8;
+    init.rx_hold_frames = 31;
+    CHECK_EQUAL(TINY_SUCCESS, reinitialize(init, true));
+    init.rx_hold_frames = 32;
+    CHECK_EQUAL(TINY_ERR_INVALID_DATA, reinitialize(init, true));
+    init.rx_hold_frames = 28;
+    init.selective_repeat = true;
+    CHECK_EQUAL(TINY_ERR_INVALID_DATA, reinitialize(init, true));
+}
+
+TEST(TINY_FD_ABM, ABM_RnrSentAtRxLowWater)
+{
+    tiny_fd_init_t init = defaultInit();
+    init.window_frames = 4;
+    init.mtu = 16;
+    init.rx_hold_frames = 3;
+    init.rx_low_water = 1;
+    CHECK_EQUAL(TINY_SUCCESS, reinitialize(init, true));
+    establishConnection();
+    std::vector<uint8_t *> held;
+    readFunc = [&](uint8_t *buf, int len) {
+        CHECK_EQUAL(TINY_SUCCESS, tiny_fd_rx_hold(handle, buf));
+        held.push_back(buf);
+    };
+    std::vector<std::pair<uint8_t, uint8_t>> sent;
+    logFrameFunc = [&](tiny_fd_handle_t, tiny_fd_frame_direction_t direction, tiny_fd_frame_type_t frame_type,
+                       tiny_fd_frame_subtype_t frame_subtype, uint8_t, uint8_t nr, const uint8_t *, int) {
+        if ( direction == TINY_FD_FRAME_DIRECTION_OUT && frame_type == TINY_FD_FRAME_TYPE_S )
+        {
+            sent.push_back({frame_subtype, nr});
+        }
+    };
+    for ( uint8_t ns = 0; ns < 2; ns++ )
+    {
+        const uint8_t frame[] = {0x7E, 0x03, (uint8_t)(ns << 1), (uint8_t)('A' + ns), 0x7E};
+        CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, frame, sizeof(frame)));
+        while ( tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0) > 0 );
+    }
+    // One slot still can be held, but it is the low-water mark
+    CHECK_EQUAL(2, (int)sent.size());
+    CHECK_EQUAL(TINY_FD_FRAME_SUBTYPE_RR, sent[0].first);
+    CHECK_EQUAL(TINY_FD_FRAME_SUBTYPE_RNR, sent[1].first);
+    CHECK_EQUAL(2, sent[1].second);
+    // Peer can still finish the frame in flight
+    const uint8_t frame[] = {0x7E, 0x03, 0x04, 'C', 0x7E};
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, frame, sizeof(frame)));
+    while ( tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0) > 0 );
+    CHECK_EQUAL(3, (int)held.size());
+    // Single released slot doesn't rise above the mark
+    sent.clear();
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_rx_release(handle, held[0]));
+    CHECK_EQUAL(0, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_rx_release(handle, held[1]));
+    CHECK_EQUAL(4, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+    CHECK_EQUAL(0x01, outBuffer[1]);
+    CHECK_EQUAL(0x61, outBuffer[2]); // RR, N(R)=3
+    readFunc = nullptr;
+}
+
+TEST(TINY_FD_ABM, ABM_PeerRnrSuspendsIFrames)
+{
+    establishConnection();
+    // RNR response: peer received nothing yet, and cannot accept I-frames
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x01\x05\x7E", 4));
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "A", 1, 0));
+    CHECK_EQUAL(0, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+    // Busy peer is polled by RR command after retry timeout
+    std::this_thread::sleep_for(std::chrono::milliseconds(110));
+    CHECK_EQUAL(4, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+    CHECK_EQUAL(0x03, outBuffer[1]);
+    CHECK_EQUAL(0x11, outBuffer[2]); // RR, N(R)=0, P
+    // RR clears busy condition, and queued I-frame goes to the line
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x01\x11\x7E", 4));
+    CHECK_EQUAL(5, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+    CHECK_EQUAL(0x00, outBuffer[2]); // I(0,0)
+    CHECK_EQUAL('A', outBuffer[3]);
+}
+
+TEST(TINY_FD_ABM, ABM_DelayedAckCoalescesFrames)
+{
+    tiny_fd_init_t init = defaultInit();
+    init.ack_frames = 5; // Limited by half of the window
+    init.ack_delay = 50;
+    CHECK_EQUAL(TINY_SUCCESS, reinitialize(init));
+    establishConnection();
+    for ( uint8_t ns = 0; ns < 4; ns++ )
+    {
+        const uint8_t frame[] = {0x7E, 0x03, (uint8_t)(ns << 1), 'A', 0x7E};
+        CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, frame, sizeof(frame)));
+        if ( ns == 2 )
+        {
+            // Single RR confirms 3 frames
+            CHECK_EQUAL(4, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+            CHECK_EQUAL(0x61, outBuffer[2]); // RR, N(R)=3
+        }
+        else
+        {
+            CHECK_EQUAL(0, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+        }
+    }
+    // The last frame is confirmed after ack delay
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    CHECK_EQUAL(4, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+    CHECK_EQUAL(0x81, outBuffer[2]); // RR, N(R)=4
+}
+
+TEST(TINY_FD_ABM, ABM_CheckpointRecoversLostTailFrame)
+{
+    tiny_fd_init_t init = defaultInit();
+    init.retry_timeout = 1000;
+    init.ack_delay = 500;
+    init.checkpointing = true;
+    CHECK_EQUAL(TINY_SUCCESS, reinitialize(init));
+    establishConnection();
+    // Only the last queued frame carries P bit
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "A", 1, 0));
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "B", 1, 0));
+    CHECK_EQUAL(5, tiny_fd_get_tx_data(handle, outBuffer.data(), 5, 0));
+    CHECK_EQUAL(0x00, outBuffer[2]); // I-frame, N(S)=0
+    CHECK_EQUAL(5, tiny_fd_get_tx_data(handle, outBuffer.data(), 5, 0));
+    CHECK_EQUAL(0x12, outBuffer[2]); // I-frame, N(S)=1, P
+    // Frame N(S)=1 is lost: the peer answers checkpoint with RR F, N(R)=1, and it is retransmitted immediately
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x01\x31\x7E", 4));
+    CHECK_EQUAL(5, tiny_fd_get_tx_data(handle, outBuffer.data(), 5, 0));
+    CHECK_EQUAL(0x12, outBuffer[2]); // I-frame, N(S)=1, P
+    CHECK_EQUAL('B', outBuffer[3]);
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x01\x51\x7E", 4)); // RR F, N(R)=2
+    CHECK_EQUAL(0, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+    // Received checkpoint is answered at once in spite of delayed acknowledgements
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x03\x50\x41\x7E", 5)); // I-frame, N(S)=0, N(R)=2, P
+    CHECK_EQUAL(4, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+    CHECK_EQUAL(0x31, outBuffer[2]); // RR F, N(R)=1
+}
+
+TEST(TINY_FD_ABM, ABM_CheckpointAnswerAfterRejIsIgnored)
+{
+    tiny_fd_init_t init = defaultInit();
+    init.retry_timeout = 1000;
+    init.checkpointing = true;
+    CHECK_EQUAL(TINY_SUCCESS, reinitialize(init));
+    establishConnection();
+    for ( const char *data : {"A", "B", "C"} )
+    {
+        CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, data, 1, 0));
+    }
+    auto frames = drainFrames(handle);
+    CHECK_EQUAL(3, frames.size());
+    CHECK_EQUAL(0x14, frames[2][1]); // I-frame, N(S)=2, P
+    // Frame N(S)=1 is lost: REJ rewinds the frames, and retransmitted ones don't poll the peer,
+    // since the checkpoint is not answered yet
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x01\x29\x7E", 4)); // REJ, N(R)=1
+    frames = drainFrames(handle);
+    CHECK_EQUAL(2, frames.size());
+    CHECK_EQUAL(0x02, frames[0][1]); // I-frame, N(S)=1
+    CHECK_EQUAL(0x04, frames[1][1]); // I-frame, N(S)=2
+    // Answer to the old checkpoint doesn't cause one more retransmission
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x01\x31\x7E", 4)); // RR F, N(R)=1
+    CHECK_EQUAL(0, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+    // Next frame sets new checkpoint
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x01\x61\x7E", 4)); // RR, N(R)=3
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "D", 1, 0));
+    CHECK_EQUAL(5, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+    CHECK_EQUAL(0x16, outBuffer[2]); // I-frame, N(S)=3, P
+}
+
+TEST(TINY_FD_ABM, ABM_MessageIsReassembledFromFragments)
+{
+    tiny_fd_init_t init = defaultInit();
+    init.on_message_cb = onRead;
+    init.message_size = 32;
+    init.mtu = 8;
+    // Reassembly buffer is allocated from the protocol buffer
+    CHECK_EQUAL(TINY_SUCCESS, reinitialize(init, true));
+    establishConnection();
+    std::vector<uint8_t> message;
+    readFunc = [&message](uint8_t *buf, int len) { message.assign(buf, buf + len); };
+    const char text[] = "Message longer than MTU";
+    // All fragments are queued at once, each one carries 7 bytes of message
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_message(handle, text, sizeof(text), 0));
+    int len = 0;
+    for ( int size; (size = tiny_fd_get_tx_data(handle, outBuffer.data() + len, outBuffer.size() - len, 0)) > 0; )
+    {
+        len += size;
+    }
+    CHECK_EQUAL(3 * (4 + 1 + 7) + (4 + 1 + 3), len);
+    CHECK_EQUAL(0x03, outBuffer[3]);  // First fragment, more fragments follow
+    CHECK_EQUAL(0x02, outBuffer[15]); // More fragments follow
+    CHECK_EQUAL(0x02, outBuffer[27]);
+    CHECK_EQUAL(0x00, outBuffer[39]); // Last fragment
+    // Loop the fragments back: single callback gets the whole message
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, outBuffer.data(), len));
+    CHECK_EQUAL(sizeof(text), message.size());
+    STRCMP_EQUAL(text, (const char *)message.data());
+    // Incomplete message is dropped, when the next message starts
+    message.clear();
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x03\x08\x03\x41\x7E", 6)); // N(S)=4
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x03\x0A\x01\x42\x7E", 6)); // N(S)=5
+    CHECK_EQUAL(1, message.size());
+    CHECK_EQUAL('B', message[0]);
+    // Message, which exceeds reassembly buffer, is dropped
+    message.clear();
+    for ( uint8_t ns = 6; ns < 6 + 5; ns++ )
+    {
+        // 5 fragments of 7 bytes: N(S)=6, 7, 0, 1, 2
+        const uint8_t header = (ns == 6 ? 0x01 : 0x00) | (ns < 10 ? 0x02 : 0x00);
+        const uint8_t frame[] = {0x7E, 0x03, (uint8_t)((ns & 0x07) << 1), header, '1', '2', '3', '4', '5', '6', '7', 0x7E};
+        CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, frame, sizeof(frame)));
+    }
+    CHECK_EQUAL(0, message.size());
+}
+
+TEST(TINY_FD_ABM, ABM_AdaptiveRtoFollowsMeasuredRtt)
+{
+    tiny_fd_init_t init = defaultInit();
+    init.rto_min = 300;
+    init.rto_max = 200;
+    CHECK_EQUAL(TINY_ERR_INVALID_DATA, reinitialize(init));
+    init.rto_min = 20;
+    init.rto_max = 10000;
+    init.retry_timeout = 1000;
+    init.retries = 100;
+    CHECK_EQUAL(TINY_SUCCESS, reinitialize(init));
+    establishConnection();
+    // Fast acknowledgement shortens retransmission timeout to the lower bound
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "A", 1, 0));
+    CHECK_EQUAL(5, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x01\x21\x7E", 4)); // RR, N(R)=1
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet(handle, "B", 1, 0));
+    CHECK_EQUAL(5, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+    // Lost frame is repeated long before retry_timeout: 5 times rto_min, but 10 times less than retry_timeout
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    CHECK_EQUAL(5, tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0));
+    CHECK_EQUAL(0x02, outBuffer[2]); // I(1,0)
+    CHECK_EQUAL('B', outBuffer[3]);
+    // Timeout is doubled after each retransmission: 40, 80 and 160 ms fit 300 ms, while 20 ms timeout
+    // would give 15 retransmissions. Delays of the test thread can only reduce the number.
+    int retransmissions = 0;
+    const uint32_t start = tiny_millis();
+    while ( (uint32_t)(tiny_millis() - start) < 300 )
+    {
+        if ( tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 0) > 0 && outBuffer[2] == 0x02 )
+        {
+            retransmissions++;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    CHECK(retransmissions <= 3);
+}
@@ -44,6 +44,11 @@ TEST_GROUP(TINY_FD_NRM)
         rxLen = 0;
         rxCount = 0;
         memset(rxData, 0, sizeof(rxData));
+        initProtocol(0, 0);
+    }
+
+    void initProtocol(uint8_t peerTxQuota, uint16_t peerQuantum)
+    {
         tiny_fd_init_t init{};
         init.pdata = this;
         init.addr = TINY_FD_PRIMARY_ADDR; // Primary station address
@@ -60,6 +65,8 @@ TEST_GROUP(TINY_FD_NRM)
         init.retries = 2;
         init.mode = TINY_FD_MODE_NRM;
         init.crc_type = HDLC_CRC_OFF;
+        init.peer_tx_quota = peerTxQuota;
+        init.peer_quantum = peerQuantum;
         auto result = tiny_fd_init(&handle, &init);
         CHECK_EQUAL(TINY_SUCCESS, result);
     }
@@ -522,3 +529,79 @@ TEST(TINY_FD_NRM, NRM_REJRecovery)
     CHECK_EQUAL('A', outBuffer[3]);
 }
 
+TEST(TINY_FD_NRM, NRM_PeerTxQuota)
+{
+    tiny_fd_close(handle);
+    initProtocol(2, 0);
+    tiny_fd_register_peer(handle, 0x01);
+    tiny_fd_register_peer(handle, 0x02);
+    establishConnection(0x01);
+    establishConnection(0x02);
+
+    // Peer 1 doesn't confirm anything, and can take only 2 slots of the tx window
+    uint8_t d[] = {'A'};
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet_to(handle, 0x01, d, 1, 0));
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet_to(handle, 0x01, d, 1, 0));
+    CHECK_EQUAL(TINY_ERR_TIMEOUT, tiny_fd_send_packet_to(handle, 0x01, d, 1, 0));
+    // Other peer still can queue frames
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet_to(handle, 0x02, d, 1, 0));
+
+    // Give marker back, send both frames to peer 1 and get confirmation
+    auto result = tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x05\x11\x7E", 4);
+    CHECK_EQUAL(TINY_SUCCESS, result);
+    tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100);
+    tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100);
+    result = tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x05\x51\x7E", 4); // RR+F, N(R)=2
+    CHECK_EQUAL(TINY_SUCCESS, result);
+    CHECK_EQUAL(TINY_SUCCESS, tiny_fd_send_packet_to(handle, 0x01, d, 1, 0));
+}
+
+TEST(TINY_FD_NRM, NRM_PeerQuantumLimitsFramesPerMarkerTurn)
+{
+    tiny_fd_close(handle);
+    initProtocol(0, 2);
+    tiny_fd_register_peer(handle, 0x01);
+    tiny_fd_register_peer(handle, 0x02);
+    establishConnection(0x01);
+    establishConnection(0x02);
+    auto result = tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x05\x11\x7E", 4); // RR+F from peer 1
+    CHECK_EQUAL(TINY_SUCCESS, result);
+
+    uint8_t d1[] = {'A', 'B', 'C'};
+    uint8_t d2[] = {'X'};
+    for (int i = 0; i < 3; i++)
+    {
+        CHECK(tiny_fd_send_to(handle, 0x01, &d1[i], 1, 100) > 0);
+    }
+    CHECK(tiny_fd_send_to(handle, 0x02, d2, 1, 100) > 0);
+
+    // Quantum of 2 bytes allows only 2 frames to peer 1, the last one has P bit
+    int len = tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100);
+    CHECK_EQUAL(5, len);
+    CHECK_EQUAL(0x05, outBuffer[1]);
+    CHECK_EQUAL(0x00, outBuffer[2]); // I(0,0)
+    CHECK_EQUAL('A', outBuffer[3]);
+    len = tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100);
+    CHECK_EQUAL(5, len);
+    CHECK_EQUAL(0x05, outBuffer[1]);
+    CHECK_EQUAL(0x12, outBuffer[2]); // I(1,0)+P
+    CHECK_EQUAL('B', outBuffer[3]);
+
+    // Peer 1 confirms, and the marker goes to peer 2 before the rest of peer 1 frames
+    result = tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x05\x51\x7E", 4); // RR+F, N(R)=2
+    CHECK_EQUAL(TINY_SUCCESS, result);
+    len = tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100);
+    CHECK_EQUAL(5, len);
+    CHECK_EQUAL(0x09, outBuffer[1]);
+    CHECK_EQUAL(0x10, outBuffer[2]); // I(0,0)+P
+    CHECK_EQUAL('X', outBuffer[3]);
+
+    // Next turn of peer 1
+    result = tiny_fd_on_rx_data(handle, (uint8_t *)"\x7E\x09\x31\x7E", 4); // RR+F, N(R)=1
+    CHECK_EQUAL(TINY_SUCCESS, result);
+    len = tiny_fd_get_tx_data(handle, outBuffer.data(), outBuffer.size(), 100);
+    CHECK_EQUAL(5, len);
+    CHECK_EQUAL(0x05, outBuffer[1]);
+    CHECK_EQUAL(0x14, outBuffer[2]); // I(2,0)+P
+    CHECK_EQUAL('C', outBuffer[3]);
+}